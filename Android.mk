@@ -23,16 +23,25 @@ srcs := xtest_1000.c \
 	xtest_10000.c \
 	xtest_20000.c \
 	xtest_benchmark_1000.c \
+	xtest_benchmark_2000.c \
+	xtest_cipher_stream.c \
 	xtest_helpers.c \
 	xtest_main.c \
+	xtest_rsp.c \
 	xtest_test.c \
+	xtest_vectors.c \
+	adbg/src/adbg_async_log.c \
 	adbg/src/adbg_case.c \
+	adbg/src/adbg_durations.c \
 	adbg/src/adbg_enum.c \
 	adbg/src/adbg_expect.c \
 	adbg/src/adbg_log.c \
 	adbg/src/adbg_mts.c \
+	adbg/src/adbg_report.c \
 	adbg/src/adbg_run.c \
+	adbg/src/adbg_soak.c \
 	adbg/src/adbg_util.c \
+	adbg/src/adbg_watchdog.c \
 	adbg/src/r_list_genutil.c \
 	adbg/src/security_utils_hex.c \
 	adbg/src/security_utils_mem.c
@@ -66,13 +75,41 @@ endif
 
 LOCAL_CFLAGS += -DUSER_SPACE
 LOCAL_CFLAGS += -DTA_DIR=\"/system/lib/optee_armtz\"
+LOCAL_CFLAGS += -DXTEST_VECTOR_DIR=\"/system/etc/xtest\"
 LOCAL_CFLAGS += -pthread
+# Lets the watchdog cancel commands, see host/xtest/xtest_helpers.h
+LOCAL_LDFLAGS += -Wl,--wrap=TEEC_InvokeCommand
 
 ## target BUILD_OPTEE_OS is defined in the common ta build
 ## mk file included before, and this BUILD_OPTEE_OS will
 ## help to generate the header files under $(TA_DEV_KIT_DIR)/host_include
 LOCAL_ADDITIONAL_DEPENDENCIES := BUILD_OPTEE_OS
 
+LOCAL_REQUIRED_MODULES := KAS_ECC_CDH_PrimitiveTest.rsp \
+	186-3dsa_SigGen.rsp \
+	186-2ecdsa_SigGen.rsp
+
 include $(BUILD_EXECUTABLE)
 
+include $(CLEAR_VARS)
+LOCAL_MODULE := KAS_ECC_CDH_PrimitiveTest.rsp
+LOCAL_MODULE_CLASS := ETC
+LOCAL_MODULE_PATH := $(TARGET_OUT_ETC)/xtest
+LOCAL_SRC_FILES := host/xtest/nist/$(LOCAL_MODULE)
+include $(BUILD_PREBUILT)
+
+include $(CLEAR_VARS)
+LOCAL_MODULE := 186-3dsa_SigGen.rsp
+LOCAL_MODULE_CLASS := ETC
+LOCAL_MODULE_PATH := $(TARGET_OUT_ETC)/xtest
+LOCAL_SRC_FILES := host/xtest/nist/$(LOCAL_MODULE)
+include $(BUILD_PREBUILT)
+
+include $(CLEAR_VARS)
+LOCAL_MODULE := 186-2ecdsa_SigGen.rsp
+LOCAL_MODULE_CLASS := ETC
+LOCAL_MODULE_PATH := $(TARGET_OUT_ETC)/xtest
+LOCAL_SRC_FILES := host/xtest/nist/$(LOCAL_MODULE)
+include $(BUILD_PREBUILT)
+
 include $(LOCAL_PATH)/ta/Android.mk
@@ -82,6 +82,7 @@ typedef struct {
 typedef struct {
 	const ADBG_Case_Definition_t *CaseDefinition_p;
 	const char *WhyDisabled_p;
+	bool Serial; /* Must not run in parallel with other cases */
 } ADBG_Case_SuiteEntry_t;
 
 typedef struct {
@@ -115,6 +116,13 @@ typedef struct {
 #define ADBG_SUITE_ENTRY(name, WhyDisabledOrNULL) \
 	{ &name, WhyDisabledOrNULL },
 
+/**
+ * Defines a suite entry for a case that has to run alone, for instance
+ * because it modifies files other cases depend on.
+ */
+#define ADBG_SUITE_ENTRY_SERIAL(name, WhyDisabledOrNULL) \
+	{ &name, WhyDisabledOrNULL, true },
+
 #define ADBG_SUITE_DEFINE_END() { NULL, NULL } };
 
 /*************************************************************************
@@ -442,6 +450,103 @@ void Do_ADBG_AbortSuite(ADBG_Case_t *const Case_p);
 #define ADBG_CASE_ABORT() (return)
 
 
+/**
+ * Makes Do_ADBG_RunSuite() run up to NumJobs cases at a time, each in a
+ * forked process. The output of each case is captured and printed, and
+ * its result merged, in suite order. ForkInit_fp, if not NULL, is
+ * called in the new process before the case runs. Its Slot argument is
+ * below NumJobs and differs between jobs running at the same time, so
+ * it can be used to give each job a device of its own.
+ */
+void Do_ADBG_SetNumJobs(size_t NumJobs, void (*ForkInit_fp)(size_t Slot));
+
+/**
+ * Makes Do_ADBG_RunSuite() run only shard Index, 0 <= Index < NumShards,
+ * of the selected cases. The cases are dealt out round-robin in suite
+ * order, so the shards are the same on every run and together cover
+ * each selected case exactly once.
+ */
+void Do_ADBG_SetShard(size_t Index, size_t NumShards);
+
+/**
+ * Makes Do_ADBG_Log() and the functions built on it append to a ring
+ * buffer of at least BufSize bytes that a background thread writes to
+ * stdout, instead of writing and flushing stdout for each line. The ring
+ * is flushed when each case ends and when the process is killed by a
+ * signal. Output printed directly to stdout isn't ordered with it.
+ *
+ * @return false if BufSize is above 1 GiB or the ring or the thread can't
+ * be created
+ */
+bool Do_ADBG_SetAsyncLog(size_t BufSize);
+
+/* Waits until all logged output has been written to stdout */
+void Do_ADBG_FlushLog(void);
+
+/**
+ * Makes Do_ADBG_RunSuite() run the selected cases NumIterations times,
+ * or until Duration_us has passed, whichever comes first. 0 leaves that
+ * limit out. Each case's duration is tracked over the iterations and a
+ * summary lists the cases that keep getting slower. The return value is
+ * then the sum of the failed cases of all iterations.
+ */
+void Do_ADBG_SetRepeat(size_t NumIterations, uint64_t Duration_us);
+
+/**
+ * Makes a subcase that passed, other than the main subcase of a case,
+ * leave the subcase tree and give its memory back when it ends. Only
+ * the number of such subcases is kept, so a case running any number of
+ * passing subcases, like one per test vector, uses bounded memory.
+ * Collapsed subcases aren't listed with the durations or in reports.
+ */
+void Do_ADBG_SetCollapsePassing(bool Collapse);
+
+/**
+ * Keeps the duration and the outcome of each case in FileName_p, a text
+ * file updated when Do_ADBG_RunSuite() ends. The file is created if it
+ * doesn't exist.
+ *
+ * @return false if the file exists but can't be read
+ */
+bool Do_ADBG_SetDurationDB(const char *FileName_p);
+
+/**
+ * Makes Do_ADBG_RunSuite() run only the selected cases expected to fit
+ * in Budget_us according to the duration database. Cases that failed
+ * last time are picked first, then those run least recently. The picked
+ * cases run longest first.
+ */
+void Do_ADBG_SetBudget(uint64_t Budget_us);
+
+/**
+ * Limits how long a case, and each operation watched with
+ * Do_ADBG_WatchOp(), may run. 0 leaves that limit out. When a limit is
+ * hit the case is recorded as timed out and Cancel_fp is called for each
+ * of its operations in flight, and for those it starts later, so it can
+ * return and the suite carry on. A case still running 10 s later makes
+ * its process exit. With a limit set, Do_ADBG_RunSuite() runs each case
+ * in a forked process, serial cases one at a time, so the suite can
+ * carry on with the next case then.
+ */
+void Do_ADBG_SetWatchdog(uint64_t CaseLimit_us, uint64_t OpLimit_us,
+			 void (*Cancel_fp)(void *Op_p));
+
+/*
+ * Brackets a blocking operation, like a command invoked in a TA, that the
+ * watchdog may cancel. Op_p is passed to Cancel_fp.
+ */
+void Do_ADBG_WatchOp(void *Op_p);
+void Do_ADBG_UnwatchOp(void *Op_p);
+
+/**
+ * Makes Do_ADBG_RunSuite() write a report of the results to FileName_p.
+ * Format_p is "junit" for JUnit XML or "json". The report is updated as
+ * each case ends and stays well-formed if the suite is interrupted.
+ *
+ * @return false if the format is unknown or the file can't be created
+ */
+bool Do_ADBG_AddReport(const char *Format_p, const char *FileName_p);
+
 int Do_ADBG_RunSuite(const ADBG_Suite_Definition_t *Suite_p, int argc,
 		     char *argv[]);
 
@@ -450,6 +555,9 @@ void Do_ADBG_MTS_Suite(const ADBG_Suite_Definition_t *Suite_p, int argc,
 
 ADBG_SuiteData_t *Do_ADBG_GetSuiteData(const ADBG_Case_t *const Case_p);
 
+/* Returns true if an expectation of the case has failed so far */
+bool Do_ADBG_CaseFailed(const ADBG_Case_t *const Case_p);
+
 /*
  * SubCase functions
  */
@@ -461,4 +569,21 @@ void Do_ADBG_EndSubCase(ADBG_Case_t *const Case_p,
 			const char *const FormatTitle_p,
 			...) __attribute__((__format__(__printf__, 2, 3)));
 
+/*
+ * Detached case functions
+ *
+ * A detached case lets a worker thread run part of a case. It records
+ * expectations like any case and buffers the Do_ADBG_Log() output of
+ * the thread that began it until Do_ADBG_EndDetachedCase().
+ * Do_ADBG_MergeDetachedCase() adds the result to the current subcase of
+ * Case_p, prints the buffered output and frees the detached case, the
+ * caller decides in which order detached cases are merged.
+ */
+ADBG_Case_t *Do_ADBG_BeginDetachedCase(ADBG_Case_t *const Case_p);
+
+void Do_ADBG_EndDetachedCase(ADBG_Case_t *const Detached_p);
+
+void Do_ADBG_MergeDetachedCase(ADBG_Case_t *const Case_p,
+			       ADBG_Case_t *const Detached_p);
+
 #endif /* ADBG_H */
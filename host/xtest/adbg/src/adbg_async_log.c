@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) 2015, Linaro Limited
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License Version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ */
+
+/*************************************************************************
+ * 1. Includes
+ ************************************************************************/
+#include "adbg_int.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+
+/*************************************************************************
+ * 2. Definition of external constants and variables
+ ************************************************************************/
+
+/*************************************************************************
+ * 3. File scope types, constants and variables
+ ************************************************************************/
+
+/* How long the writer sleeps at most before checking for new output */
+#define ADBG_ASYNC_LOG_POLL_MS 10
+
+#define ADBG_ASYNC_LOG_MIN_SIZE 4096
+/* Power of two, so doubling up to it can't wrap */
+#define ADBG_ASYNC_LOG_MAX_SIZE (1024 * 1024 * 1024)
+
+/*
+ * Ring between the logging threads and the writer thread. Head and Tail
+ * are free running byte counters, Head only moves when a logging thread
+ * has copied a string in and Tail only when the writer thread has
+ * written it out, so neither side waits for the other unless the ring is
+ * full. ProducerMutex only serializes threads logging at the same time
+ * and is never taken by the writer.
+ */
+typedef struct {
+	char *Buf_p;
+	size_t Size;		/* Power of two */
+	size_t Head;
+	size_t Tail;
+	bool Active;
+	bool Stop;
+	pid_t Pid;		/* Process owning the writer thread */
+	pthread_t Thread;
+	pthread_mutex_t ProducerMutex;
+	pthread_mutex_t Mutex;	/* Protects nothing but the conditions */
+	pthread_cond_t DataCond;
+	pthread_cond_t DrainedCond;
+} ADBG_AsyncLog_t;
+
+static ADBG_AsyncLog_t ADBG_AsyncLog = {
+	.ProducerMutex = PTHREAD_MUTEX_INITIALIZER,
+	.Mutex = PTHREAD_MUTEX_INITIALIZER,
+	.DataCond = PTHREAD_COND_INITIALIZER,
+	.DrainedCond = PTHREAD_COND_INITIALIZER,
+};
+
+/* Signals after which the remaining output is written before dying */
+static const int ADBG_AsyncLog_Signals[] = {
+	SIGABRT, SIGBUS, SIGFPE, SIGILL, SIGINT, SIGSEGV, SIGTERM,
+};
+
+/*************************************************************************
+ * 4. Declaration of file local functions
+ ************************************************************************/
+
+static void *ADBG_AsyncLog_Writer(void *Arg_p);
+
+static void ADBG_AsyncLog_Signal(int Sig);
+
+static void ADBG_AsyncLog_Stop(void);
+
+static void ADBG_AsyncLog_TimedWait(pthread_cond_t *Cond_p);
+
+/*************************************************************************
+ * 5. Definition of external functions
+ ************************************************************************/
+bool Do_ADBG_SetAsyncLog(
+	size_t BufSize
+	)
+{
+	ADBG_AsyncLog_t *Log_p = &ADBG_AsyncLog;
+	struct sigaction sa;
+	size_t Size = ADBG_ASYNC_LOG_MIN_SIZE;
+	size_t n;
+
+	if (Log_p->Active)
+		return true;
+	if (BufSize > ADBG_ASYNC_LOG_MAX_SIZE)
+		return false;
+
+	while (Size < BufSize)
+		Size *= 2;
+	Log_p->Buf_p = HEAP_UNTYPED_ALLOC(Size);
+	if (Log_p->Buf_p == NULL)
+		return false;
+	Log_p->Size = Size;
+	Log_p->Head = 0;
+	Log_p->Tail = 0;
+	Log_p->Stop = false;
+	Log_p->Pid = getpid();
+
+	if (pthread_create(&Log_p->Thread, NULL, ADBG_AsyncLog_Writer,
+			   Log_p) != 0) {
+		HEAP_FREE(&Log_p->Buf_p);
+		return false;
+	}
+
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = ADBG_AsyncLog_Signal;
+	sa.sa_flags = SA_RESETHAND;
+	sigemptyset(&sa.sa_mask);
+	for (n = 0; n < sizeof(ADBG_AsyncLog_Signals) /
+			sizeof(ADBG_AsyncLog_Signals[0]); n++)
+		(void)sigaction(ADBG_AsyncLog_Signals[n], &sa, NULL);
+
+	/* Output logged by the test code so far goes first */
+	fflush(stdout);
+	__atomic_store_n(&Log_p->Active, true, __ATOMIC_RELEASE);
+	atexit(ADBG_AsyncLog_Stop);
+	return true;
+}
+
+void Do_ADBG_FlushLog(void)
+{
+	ADBG_AsyncLog_t *Log_p = &ADBG_AsyncLog;
+
+	if (!__atomic_load_n(&Log_p->Active, __ATOMIC_ACQUIRE)) {
+		fflush(stdout);
+		return;
+	}
+
+	pthread_mutex_lock(&Log_p->Mutex);
+	while (__atomic_load_n(&Log_p->Tail, __ATOMIC_ACQUIRE) !=
+	       __atomic_load_n(&Log_p->Head, __ATOMIC_ACQUIRE)) {
+		pthread_cond_signal(&Log_p->DataCond);
+		ADBG_AsyncLog_TimedWait(&Log_p->DrainedCond);
+	}
+	pthread_mutex_unlock(&Log_p->Mutex);
+	fflush(stdout);
+}
+
+bool ADBG_AsyncLog_Write(
+	const char *String_p,
+	size_t Len
+	)
+{
+	ADBG_AsyncLog_t *Log_p = &ADBG_AsyncLog;
+
+	if (!__atomic_load_n(&Log_p->Active, __ATOMIC_ACQUIRE))
+		return false;
+
+	pthread_mutex_lock(&Log_p->ProducerMutex);
+	while (Len > 0) {
+		size_t Tail = __atomic_load_n(&Log_p->Tail, __ATOMIC_ACQUIRE);
+		size_t Head = Log_p->Head;
+		size_t Offs = Head & (Log_p->Size - 1);
+		size_t n = MIN(Len, Log_p->Size - (Head - Tail));
+
+		if (n == 0) {
+			/* Full, wait for the writer to catch up */
+			pthread_mutex_lock(&Log_p->Mutex);
+			pthread_cond_signal(&Log_p->DataCond);
+			if (__atomic_load_n(&Log_p->Tail, __ATOMIC_ACQUIRE) ==
+			    Tail)
+				ADBG_AsyncLog_TimedWait(&Log_p->DrainedCond);
+			pthread_mutex_unlock(&Log_p->Mutex);
+			continue;
+		}
+
+		if (n > Log_p->Size - Offs) {
+			memcpy(Log_p->Buf_p + Offs, String_p,
+			       Log_p->Size - Offs);
+			memcpy(Log_p->Buf_p, String_p + Log_p->Size - Offs,
+			       n - (Log_p->Size - Offs));
+		} else {
+			memcpy(Log_p->Buf_p + Offs, String_p, n);
+		}
+		__atomic_store_n(&Log_p->Head, Head + n, __ATOMIC_RELEASE);
+
+		/*
+		 * Only wake the writer when it may have gone to sleep, a
+		 * missed wakeup costs at most ADBG_ASYNC_LOG_POLL_MS.
+		 */
+		if (Head == Tail)
+			pthread_cond_signal(&Log_p->DataCond);
+
+		String_p += n;
+		Len -= n;
+	}
+	pthread_mutex_unlock(&Log_p->ProducerMutex);
+	return true;
+}
+
+void ADBG_AsyncLog_Disable(void)
+{
+	/* The writer thread doesn't exist in a forked process */
+	__atomic_store_n(&ADBG_AsyncLog.Active, false, __ATOMIC_RELEASE);
+}
+
+/*************************************************************************
+ * 6. Definitions of internal functions
+ ************************************************************************/
+
+/* Must be called with Mutex held */
+static void ADBG_AsyncLog_TimedWait(
+	pthread_cond_t *Cond_p
+	)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	ts.tv_nsec += ADBG_ASYNC_LOG_POLL_MS * 1000000;
+	if (ts.tv_nsec >= 1000000000) {
+		ts.tv_sec++;
+		ts.tv_nsec -= 1000000000;
+	}
+	(void)pthread_cond_timedwait(Cond_p, &ADBG_AsyncLog.Mutex, &ts);
+}
+
+/* Writes the ring from Tail to Head, returns the new Tail */
+static size_t ADBG_AsyncLog_Drain(
+	ADBG_AsyncLog_t *Log_p,
+	size_t Tail,
+	size_t Head
+	)
+{
+	while (Tail != Head) {
+		size_t Offs = Tail & (Log_p->Size - 1);
+		size_t n = MIN(Head - Tail, Log_p->Size - Offs);
+		ssize_t Res = write(STDOUT_FILENO, Log_p->Buf_p + Offs, n);
+
+		if (Res < 0 && errno == EINTR)
+			continue;
+		/* Drop the output rather than block the tests forever */
+		if (Res <= 0)
+			Res = n;
+		Tail += Res;
+	}
+	return Tail;
+}
+
+static void *ADBG_AsyncLog_Writer(
+	void *Arg_p
+	)
+{
+	ADBG_AsyncLog_t *Log_p = Arg_p;
+	size_t Tail = Log_p->Tail;
+
+	while (true) {
+		size_t Head = __atomic_load_n(&Log_p->Head, __ATOMIC_ACQUIRE);
+
+		if (Head != Tail) {
+			/* Keep what was printed directly before it in order */
+			fflush(stdout);
+			Tail = ADBG_AsyncLog_Drain(Log_p, Tail, Head);
+			__atomic_store_n(&Log_p->Tail, Tail, __ATOMIC_RELEASE);
+		}
+
+		pthread_mutex_lock(&Log_p->Mutex);
+		pthread_cond_broadcast(&Log_p->DrainedCond);
+		if (__atomic_load_n(&Log_p->Head, __ATOMIC_ACQUIRE) == Tail) {
+			if (Log_p->Stop) {
+				pthread_mutex_unlock(&Log_p->Mutex);
+				break;
+			}
+			ADBG_AsyncLog_TimedWait(&Log_p->DataCond);
+		}
+		pthread_mutex_unlock(&Log_p->Mutex);
+	}
+	return NULL;
+}
+
+/*
+ * Writes what's left in the ring and lets the signal take its default
+ * action. The writer thread may be writing the same data at the moment,
+ * duplicated lines are preferred over lost ones here.
+ */
+static void ADBG_AsyncLog_Signal(
+	int Sig
+	)
+{
+	ADBG_AsyncLog_t *Log_p = &ADBG_AsyncLog;
+
+	if (__atomic_load_n(&Log_p->Active, __ATOMIC_ACQUIRE))
+		(void)ADBG_AsyncLog_Drain(Log_p,
+			__atomic_load_n(&Log_p->Tail, __ATOMIC_ACQUIRE),
+			__atomic_load_n(&Log_p->Head, __ATOMIC_ACQUIRE));
+	(void)raise(Sig);
+}
+
+static void ADBG_AsyncLog_Stop(void)
+{
+	ADBG_AsyncLog_t *Log_p = &ADBG_AsyncLog;
+
+	if (!__atomic_load_n(&Log_p->Active, __ATOMIC_ACQUIRE) ||
+	    Log_p->Pid != getpid())
+		return;
+
+	Do_ADBG_FlushLog();
+	__atomic_store_n(&Log_p->Active, false, __ATOMIC_RELEASE);
+
+	pthread_mutex_lock(&Log_p->Mutex);
+	Log_p->Stop = true;
+	pthread_cond_signal(&Log_p->DataCond);
+	pthread_mutex_unlock(&Log_p->Mutex);
+	pthread_join(Log_p->Thread, NULL);
+}
@@ -24,16 +24,12 @@
 * 3. File scope types, constants and variables
 *************************************************************************/
 
+static bool ADBG_CollapsePassing;
+
 /*************************************************************************
 * 4. Declaration of file local functions
 *************************************************************************/
 
-/*
- * Deletes a subcase. Don't call this function before the
- * subcase is removed from list.
- */
-static void ADBG_SubCase_Delete(ADBG_SubCase_t *SubCase);
-
 static ADBG_SubCase_t *ADBG_Case_CreateSubCase(ADBG_Case_t *Case_p,
 					       const char *const Title_p);
 
@@ -42,6 +38,10 @@ static ADBG_SubCase_t *ADBG_Case_GetParentSubCase(ADBG_Case_t *Case_p,
 
 static const char *ADBG_Case_GetTestID(ADBG_Case_t *Case_p);
 
+static bool ADBG_SubCase_Save(const ADBG_SubCase_t *SubCase_p, FILE *File_p);
+
+static bool ADBG_SubCase_Load(ADBG_Case_t *Case_p, FILE *File_p);
+
 /*************************************************************************
 * 5. Definition of external functions
 *************************************************************************/
@@ -66,7 +66,8 @@ void ADBG_Case_Delete(
 	ADBG_Case_t *Case_p
 	)
 {
-	ADBG_SubCase_Delete(Case_p->FirstSubCase_p);
+	ADBG_Arena_Free(&Case_p->Arena);
+	HEAP_FREE(&Case_p->LogBuf_p);
 	HEAP_FREE(&Case_p);
 }
 
@@ -270,6 +271,10 @@ void Do_ADBG_EndSubCase(
 			Parent_p->Result.NumFailedSubCases++;
 	}
 
+	/* A merged detached case may already have set the end time */
+	if (SubCase_p->EndTime_us == 0)
+		SubCase_p->EndTime_us = ADBG_GetTime_us();
+
 	/* Print a summary of the subcase result */
 	if (SubCase_p->Result.NumFailedTests > 0 ||
 	    SubCase_p->Result.NumFailedSubTests > 0) {
@@ -281,6 +286,29 @@ void Do_ADBG_EndSubCase(
 	/* Update current subcase to be the parent of this subcase */
 	Case_p->CurrentSubCase_p =
 		ADBG_Case_GetParentSubCase(Case_p, SubCase_p);
+
+	/*
+	 * A passing subcase only passes if all its subcases did, so they
+	 * have been collapsed already and the subcase is the last thing
+	 * allocated in the arena.
+	 */
+	if (ADBG_CollapsePassing && SubCase_p->Parent_p != NULL &&
+	    SubCase_p->Result.NumFailedTests == 0 &&
+	    SubCase_p->Result.NumFailedSubTests == 0) {
+		ADBG_SubCase_t *Parent_p = SubCase_p->Parent_p;
+
+		Parent_p->Result.NumCollapsedSubCases +=
+			1 + SubCase_p->Result.NumCollapsedSubCases;
+		TAILQ_REMOVE(&Parent_p->SubCasesList, SubCase_p, Link);
+		ADBG_Arena_Release(&Case_p->Arena, SubCase_p->ArenaMark);
+	}
+}
+
+void Do_ADBG_SetCollapsePassing(
+	bool Collapse
+	)
+{
+	ADBG_CollapsePassing = Collapse;
 }
 
 void Do_ADBG_AbortSuite(
@@ -295,6 +323,127 @@ ADBG_SuiteData_t *Do_ADBG_GetSuiteData(const ADBG_Case_t *const Case_p)
 	return Case_p->SuiteData_p;
 }
 
+bool Do_ADBG_CaseFailed(
+	const ADBG_Case_t *const Case_p
+	)
+{
+	const ADBG_SubCase_t *SubCase_p;
+
+	/* Ended subcases have added their failures to their parents */
+	for (SubCase_p = Case_p->CurrentSubCase_p; SubCase_p != NULL;
+	     SubCase_p = SubCase_p->Parent_p) {
+		if (SubCase_p->Result.NumFailedTests +
+		    SubCase_p->Result.NumFailedSubTests > 0)
+			return true;
+	}
+	return false;
+}
+
+ADBG_Case_t *Do_ADBG_BeginDetachedCase(
+	ADBG_Case_t *const Case_p
+	)
+{
+	ADBG_Case_t *Detached_p;
+
+	Detached_p = ADBG_Case_New(Case_p->SuiteEntry_p, Case_p->SuiteData_p);
+	if (Detached_p == NULL)
+		return NULL;
+
+	if (ADBG_Case_CreateSubCase(Detached_p, "detached") == NULL) {
+		ADBG_Case_Delete(Detached_p);
+		return NULL;
+	}
+
+	ADBG_LogCase_p = Detached_p;
+	return Detached_p;
+}
+
+void Do_ADBG_EndDetachedCase(
+	ADBG_Case_t *const Detached_p
+	)
+{
+	if (Detached_p->FirstSubCase_p != NULL)
+		Detached_p->FirstSubCase_p->EndTime_us = ADBG_GetTime_us();
+	if (ADBG_LogCase_p == Detached_p)
+		ADBG_LogCase_p = NULL;
+}
+
+void Do_ADBG_MergeDetachedCase(
+	ADBG_Case_t *const Case_p,
+	ADBG_Case_t *const Detached_p
+	)
+{
+	ADBG_SubCase_t *SubCase_p = Case_p->CurrentSubCase_p;
+	const ADBG_SubCase_t *Root_p = Detached_p->FirstSubCase_p;
+	const ADBG_Result_t *Result_p = &Root_p->Result;
+
+	if (Detached_p->LogBuf_p != NULL)
+		ADBG_LogString(Detached_p->LogBuf_p);
+
+	if (SubCase_p != NULL) {
+		SubCase_p->Result.NumTests += Result_p->NumTests;
+		SubCase_p->Result.NumFailedTests += Result_p->NumFailedTests;
+		SubCase_p->Result.NumSubTests += Result_p->NumSubTests;
+		SubCase_p->Result.NumFailedSubTests +=
+			Result_p->NumFailedSubTests;
+		SubCase_p->Result.NumCollapsedSubCases +=
+			Result_p->NumCollapsedSubCases;
+		if (SubCase_p->Result.FirstFailedRow == 0) {
+			SubCase_p->Result.FirstFailedRow =
+				Result_p->FirstFailedRow;
+			SubCase_p->Result.FirstFailedFile_p =
+				Result_p->FirstFailedFile_p;
+		}
+		/* The subcase spans the time the work actually took */
+		if (Root_p->StartTime_us < SubCase_p->StartTime_us)
+			SubCase_p->StartTime_us = Root_p->StartTime_us;
+		if (Root_p->EndTime_us > SubCase_p->EndTime_us)
+			SubCase_p->EndTime_us = Root_p->EndTime_us;
+	}
+
+	ADBG_Case_Delete(Detached_p);
+}
+
+
+/*
+ * A case is saved as its result followed by its subcases depth first,
+ * each as its result, start and end time, number of subcases, test ID
+ * and title. Only the process the saving process was forked from loads
+ * it, so the FirstFailedFile_p pointers into the binary stay valid and
+ * the CLOCK_MONOTONIC times are on the same clock.
+ */
+bool ADBG_Case_Save(
+	const ADBG_Case_t *Case_p,
+	FILE *File_p
+	)
+{
+	if (Case_p->FirstSubCase_p == NULL)
+		return false;
+	if (fwrite(&Case_p->Result, sizeof(Case_p->Result), 1, File_p) != 1)
+		return false;
+	return ADBG_SubCase_Save(Case_p->FirstSubCase_p, File_p);
+}
+
+bool ADBG_Case_Load(
+	ADBG_Case_t *Case_p,
+	FILE *File_p
+	)
+{
+	ADBG_Result_t Result;
+
+	if (fread(&Result, sizeof(Result), 1, File_p) != 1)
+		return false;
+
+	Case_p->CurrentSubCase_p = NULL;
+	if (!ADBG_SubCase_Load(Case_p, File_p)) {
+		ADBG_Arena_Free(&Case_p->Arena);
+		Case_p->FirstSubCase_p = NULL;
+		Case_p->CurrentSubCase_p = NULL;
+		return false;
+	}
+	Case_p->Result = Result;
+	return true;
+}
 
 
 /*************************************************************************
@@ -305,16 +454,19 @@ static ADBG_SubCase_t *ADBG_Case_CreateSubCase(
 	const char *const Title_p
 	)
 {
+	ADBG_ArenaMark_t Mark = ADBG_Arena_GetMark(&Case_p->Arena);
 	ADBG_SubCase_t *SubCase_p;
 
-	SubCase_p = HEAP_ALLOC(ADBG_SubCase_t);
+	SubCase_p = ADBG_Arena_Alloc(&Case_p->Arena, sizeof(ADBG_SubCase_t));
 	if (SubCase_p == NULL)
 		goto ErrorReturn;
 
 	memset(SubCase_p, 0, sizeof(ADBG_SubCase_t));
 	TAILQ_INIT(&SubCase_p->SubCasesList);
+	SubCase_p->StartTime_us = ADBG_GetTime_us();
+	SubCase_p->ArenaMark = Mark;
 
-	SubCase_p->Title_p = SECUTIL_HEAP_STRDUP(Title_p);
+	SubCase_p->Title_p = ADBG_Arena_StrDup(&Case_p->Arena, Title_p);
 	if (SubCase_p->Title_p == NULL)
 		goto ErrorReturn;
 
@@ -323,8 +475,8 @@ static ADBG_SubCase_t *ADBG_Case_CreateSubCase(
 
 	if (SubCase_p->Parent_p == NULL) {
 		/* Main SubCase */
-		SubCase_p->TestID_p =
-			SECUTIL_HEAP_STRDUP(ADBG_Case_GetTestID(Case_p));
+		SubCase_p->TestID_p = ADBG_Arena_StrDup(&Case_p->Arena,
+			ADBG_Case_GetTestID(Case_p));
 		if (SubCase_p->TestID_p == NULL)
 			goto ErrorReturn;
 
@@ -347,7 +499,8 @@ static ADBG_SubCase_t *ADBG_Case_CreateSubCase(
 				    sizeof(PrefixTitle) - strlen(PrefixTitle),
 				    ".%d",
 				    Parent_p->Result.NumSubCases);
-		SubCase_p->TestID_p = SECUTIL_HEAP_STRDUP(PrefixTitle);
+		SubCase_p->TestID_p = ADBG_Arena_StrDup(&Case_p->Arena,
+						       PrefixTitle);
 		if (SubCase_p->TestID_p == NULL)
 			goto ErrorReturn;
 
@@ -358,36 +511,10 @@ static ADBG_SubCase_t *ADBG_Case_CreateSubCase(
 	return SubCase_p;
 
 ErrorReturn:
-	ADBG_SubCase_Delete(SubCase_p);
+	ADBG_Arena_Release(&Case_p->Arena, Mark);
 	return NULL;
 }
 
-static void ADBG_SubCase_Delete(
-	ADBG_SubCase_t *SubCase_p
-	)
-{
-	if (SubCase_p != NULL) {
-		/*
-		 * Note that Util_ListDestroy() checks
-		 * if SubCase_p->SubCasesList_p
-		 * is NULL.
-		 */
-		while (true) {
-			ADBG_SubCase_t *s =
-				TAILQ_FIRST(&SubCase_p->SubCasesList);
-
-			if (s == NULL)
-				break;
-
-			TAILQ_REMOVE(&SubCase_p->SubCasesList, s, Link);
-			ADBG_SubCase_Delete(s);
-		}
-		HEAP_FREE(&SubCase_p->TestID_p);
-		HEAP_FREE(&SubCase_p->Title_p);
-		HEAP_FREE(&SubCase_p);
-	}
-}
-
 ADBG_SubCase_t *ADBG_Case_GetParentSubCase(
 	ADBG_Case_t *Case_p,
 	ADBG_SubCase_t *SubCase_p
@@ -404,3 +531,114 @@ static const char *ADBG_Case_GetTestID(ADBG_Case_t *Case_p)
 
 	return Case_p->SuiteEntry_p->CaseDefinition_p->TestID_p;
 }
+
+static bool ADBG_SaveString(const char *String_p, FILE *File_p)
+{
+	uint32_t Length = strlen(String_p);
+
+	return fwrite(&Length, sizeof(Length), 1, File_p) == 1 &&
+	       fwrite(String_p, 1, Length, File_p) == Length;
+}
+
+static char *ADBG_LoadString(FILE *File_p)
+{
+	uint32_t Length;
+	char *String_p;
+
+	if (fread(&Length, sizeof(Length), 1, File_p) != 1)
+		return NULL;
+	String_p = HEAP_UNTYPED_ALLOC(Length + 1);
+	if (String_p == NULL)
+		return NULL;
+	if (fread(String_p, 1, Length, File_p) != Length) {
+		HEAP_FREE(&String_p);
+		return NULL;
+	}
+	String_p[Length] = '\0';
+	return String_p;
+}
+
+static bool ADBG_SubCase_Save(
+	const ADBG_SubCase_t *SubCase_p,
+	FILE *File_p
+	)
+{
+	const ADBG_SubCase_t *s;
+	uint32_t NumSubCases = 0;
+
+	TAILQ_FOREACH(s, &SubCase_p->SubCasesList, Link)
+		NumSubCases++;
+
+	if (fwrite(&SubCase_p->Result, sizeof(SubCase_p->Result), 1,
+		   File_p) != 1 ||
+	    fwrite(&SubCase_p->StartTime_us, sizeof(uint64_t), 1,
+		   File_p) != 1 ||
+	    fwrite(&SubCase_p->EndTime_us, sizeof(uint64_t), 1, File_p) != 1 ||
+	    fwrite(&NumSubCases, sizeof(NumSubCases), 1, File_p) != 1 ||
+	    !ADBG_SaveString(SubCase_p->TestID_p, File_p) ||
+	    !ADBG_SaveString(SubCase_p->Title_p, File_p))
+		return false;
+
+	TAILQ_FOREACH(s, &SubCase_p->SubCasesList, Link) {
+		if (!ADBG_SubCase_Save(s, File_p))
+			return false;
+	}
+	return true;
+}
+
+/*
+ * Loads a subcase and its subcases below the current subcase of
+ * Case_p. On failure whatever was loaded is left for the caller to
+ * delete.
+ */
+static bool ADBG_SubCase_Load(
+	ADBG_Case_t *Case_p,
+	FILE *File_p
+	)
+{
+	ADBG_SubCase_t *Parent_p = Case_p->CurrentSubCase_p;
+	ADBG_SubCase_t *SubCase_p;
+	ADBG_Result_t Result;
+	uint64_t StartTime_us;
+	uint64_t EndTime_us;
+	uint32_t NumSubCases;
+	uint32_t n;
+	char *TestID_p;
+	char *Title_p;
+
+	if (fread(&Result, sizeof(Result), 1, File_p) != 1 ||
+	    fread(&StartTime_us, sizeof(StartTime_us), 1, File_p) != 1 ||
+	    fread(&EndTime_us, sizeof(EndTime_us), 1, File_p) != 1 ||
+	    fread(&NumSubCases, sizeof(NumSubCases), 1, File_p) != 1)
+		return false;
+
+	TestID_p = ADBG_LoadString(File_p);
+	if (TestID_p == NULL)
+		return false;
+	Title_p = ADBG_LoadString(File_p);
+	if (Title_p == NULL) {
+		HEAP_FREE(&TestID_p);
+		return false;
+	}
+
+	SubCase_p = ADBG_Case_CreateSubCase(Case_p, Title_p);
+	HEAP_FREE(&Title_p);
+	if (SubCase_p != NULL)
+		SubCase_p->TestID_p = ADBG_Arena_StrDup(&Case_p->Arena,
+							TestID_p);
+	HEAP_FREE(&TestID_p);
+	if (SubCase_p == NULL || SubCase_p->TestID_p == NULL)
+		return false;
+
+	for (n = 0; n < NumSubCases; n++) {
+		if (!ADBG_SubCase_Load(Case_p, File_p))
+			return false;
+		Case_p->CurrentSubCase_p = SubCase_p;
+	}
+
+	SubCase_p->Result = Result;
+	SubCase_p->StartTime_us = StartTime_us;
+	SubCase_p->EndTime_us = EndTime_us;
+	Case_p->CurrentSubCase_p = Parent_p;
+	return true;
+}
@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2015, Linaro Limited
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License Version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ */
+
+/*************************************************************************
+ * 1. Includes
+ ************************************************************************/
+#include "adbg_int.h"
+
+#include <inttypes.h>
+#include <time.h>
+
+/*************************************************************************
+ * 2. Definition of external constants and variables
+ ************************************************************************/
+
+/*************************************************************************
+ * 3. File scope types, constants and variables
+ ************************************************************************/
+
+/* Assumed duration of every case when no case has been run before */
+#define ADBG_DEFAULT_DURATION_US (10 * 1000000ULL)
+
+#define ADBG_DURATION_ID_MAX 128
+
+/*
+ * One line per case in the database file:
+ * "<test id> <duration us> <last run, seconds since epoch> <failed 0/1>"
+ */
+typedef struct {
+	char *TestID_p;
+	uint64_t Duration_us;
+	uint64_t LastRun;
+	bool Failed;
+} ADBG_Duration_t;
+
+typedef struct {
+	const char *FileName_p;
+	ADBG_Duration_t *Durations_p;
+	size_t NumDurations;
+	uint64_t Budget_us;	/* 0 if all selected cases are run */
+	uint64_t RunTime;	/* When this run started */
+} ADBG_DurationDB_t;
+
+static ADBG_DurationDB_t ADBG_DurationDB;
+
+/* Case to run with the key it's picked and ordered by */
+typedef struct {
+	const ADBG_Case_SuiteEntry_t *SuiteEntry_p;
+	const ADBG_Duration_t *Duration_p;
+	uint64_t Cost_us;
+} ADBG_Candidate_t;
+
+/*************************************************************************
+ * 4. Declaration of file local functions
+ ************************************************************************/
+
+static ADBG_Duration_t *ADBG_Durations_Find(const char *TestID_p);
+
+static ADBG_Duration_t *ADBG_Durations_Add(const char *TestID_p);
+
+static int ADBG_Candidate_ComparePriority(const void *a_p, const void *b_p);
+
+static int ADBG_Candidate_CompareCost(const void *a_p, const void *b_p);
+
+static uint64_t ADBG_Durations_Mul(uint64_t a, uint64_t b);
+
+/*************************************************************************
+ * 5. Definition of external functions
+ ************************************************************************/
+bool Do_ADBG_SetDurationDB(
+	const char *FileName_p
+	)
+{
+	ADBG_DurationDB_t *DB_p = &ADBG_DurationDB;
+	char TestID[ADBG_DURATION_ID_MAX];
+	uint64_t Duration_us;
+	uint64_t LastRun;
+	unsigned Failed;
+	FILE *File_p;
+
+	DB_p->FileName_p = FileName_p;
+	DB_p->RunTime = time(NULL);
+
+	File_p = fopen(FileName_p, "r");
+	if (File_p == NULL)
+		return true;	/* Created after the first run */
+
+	while (fscanf(File_p, "%127s %" SCNu64 " %" SCNu64 " %u", TestID,
+		      &Duration_us, &LastRun, &Failed) == 4) {
+		ADBG_Duration_t *Duration_p = ADBG_Durations_Add(TestID);
+
+		if (Duration_p == NULL) {
+			fclose(File_p);
+			return false;
+		}
+		Duration_p->Duration_us = Duration_us;
+		Duration_p->LastRun = LastRun;
+		Duration_p->Failed = Failed != 0;
+	}
+	fclose(File_p);
+	return true;
+}
+
+void Do_ADBG_SetBudget(
+	uint64_t Budget_us
+	)
+{
+	ADBG_DurationDB.Budget_us = Budget_us;
+}
+
+/*
+ * Greedily picks the cases that fit the budget in order of priority and
+ * orders them longest first. With NumJobs jobs NumJobs cases share the
+ * budget, except serial cases which have the whole suite to themselves.
+ */
+size_t ADBG_Durations_Select(
+	const ADBG_Case_SuiteEntry_t **Entries_pp,
+	size_t *NumEntries_p,
+	size_t NumJobs
+	)
+{
+	ADBG_DurationDB_t *DB_p = &ADBG_DurationDB;
+	ADBG_Candidate_t *Candidates_p;
+	uint64_t Default_us = ADBG_DEFAULT_DURATION_US;
+	uint64_t Left_us = ADBG_Durations_Mul(DB_p->Budget_us, NumJobs);
+	size_t NumSelected = 0;
+	size_t NumKnown = 0;
+	uint64_t Sum_us = 0;
+	size_t n;
+
+	if (DB_p->Budget_us == 0 || *NumEntries_p == 0)
+		return 0;
+
+	Candidates_p = HEAP_UNTYPED_ALLOC(*NumEntries_p *
+					  sizeof(ADBG_Candidate_t));
+	if (Candidates_p == NULL)
+		return 0;
+
+	for (n = 0; n < *NumEntries_p; n++) {
+		Candidates_p[n].SuiteEntry_p = Entries_pp[n];
+		Candidates_p[n].Duration_p = ADBG_Durations_Find(
+			Entries_pp[n]->CaseDefinition_p->TestID_p);
+		if (Candidates_p[n].Duration_p != NULL) {
+			Sum_us += Candidates_p[n].Duration_p->Duration_us;
+			NumKnown++;
+		}
+	}
+	/* Cases never run are assumed to take as long as the average one */
+	if (NumKnown > 0)
+		Default_us = Sum_us / NumKnown;
+
+	for (n = 0; n < *NumEntries_p; n++) {
+		ADBG_Candidate_t *c = &Candidates_p[n];
+
+		if (c->SuiteEntry_p->WhyDisabled_p != NULL)
+			c->Cost_us = 0;
+		else if (c->Duration_p != NULL)
+			c->Cost_us = c->Duration_p->Duration_us;
+		else
+			c->Cost_us = Default_us;
+		if (c->SuiteEntry_p->Serial)
+			c->Cost_us = ADBG_Durations_Mul(c->Cost_us, NumJobs);
+	}
+
+	qsort(Candidates_p, *NumEntries_p, sizeof(ADBG_Candidate_t),
+	      ADBG_Candidate_ComparePriority);
+	for (n = 0; n < *NumEntries_p; n++) {
+		if (Candidates_p[n].Cost_us > Left_us)
+			continue;
+		Left_us -= Candidates_p[n].Cost_us;
+		Candidates_p[NumSelected++] = Candidates_p[n];
+	}
+
+	qsort(Candidates_p, NumSelected, sizeof(ADBG_Candidate_t),
+	      ADBG_Candidate_CompareCost);
+	for (n = 0; n < NumSelected; n++)
+		Entries_pp[n] = Candidates_p[n].SuiteEntry_p;
+
+	n = *NumEntries_p - NumSelected;
+	*NumEntries_p = NumSelected;
+	HEAP_FREE(&Candidates_p);
+	return n;
+}
+
+void ADBG_Durations_Update(
+	const ADBG_Case_t *Case_p
+	)
+{
+	ADBG_DurationDB_t *DB_p = &ADBG_DurationDB;
+	const ADBG_SubCase_t *SubCase_p = Case_p->FirstSubCase_p;
+	ADBG_Duration_t *Duration_p;
+
+	if (DB_p->FileName_p == NULL || SubCase_p == NULL ||
+	    Case_p->Result.WhySkipped_p != NULL)
+		return;
+
+	Duration_p = ADBG_Durations_Find(SubCase_p->TestID_p);
+	if (Duration_p == NULL)
+		Duration_p = ADBG_Durations_Add(SubCase_p->TestID_p);
+	if (Duration_p == NULL)
+		return;
+
+	Duration_p->Duration_us = 0;
+	if (SubCase_p->EndTime_us > SubCase_p->StartTime_us)
+		Duration_p->Duration_us = SubCase_p->EndTime_us -
+					  SubCase_p->StartTime_us;
+	Duration_p->LastRun = DB_p->RunTime;
+	Duration_p->Failed = Case_p->Result.NumFailedTests +
+			     Case_p->Result.NumFailedSubTests > 0;
+}
+
+/* Writes a new file and renames it so an interrupted save loses nothing */
+void ADBG_Durations_Save(void)
+{
+	ADBG_DurationDB_t *DB_p = &ADBG_DurationDB;
+	char TmpName[256];
+	FILE *File_p;
+	bool Ok = true;
+	size_t n;
+
+	if (DB_p->FileName_p == NULL)
+		return;
+
+	(void)ADBG_snprintf(TmpName, sizeof(TmpName), "%s.tmp",
+			    DB_p->FileName_p);
+	File_p = fopen(TmpName, "w");
+	if (File_p == NULL) {
+		Do_ADBG_Log("Cannot write duration database %s", TmpName);
+		return;
+	}
+
+	for (n = 0; n < DB_p->NumDurations; n++) {
+		const ADBG_Duration_t *Duration_p = &DB_p->Durations_p[n];
+
+		if (fprintf(File_p, "%s %" PRIu64 " %" PRIu64 " %d\n",
+			    Duration_p->TestID_p, Duration_p->Duration_us,
+			    Duration_p->LastRun, Duration_p->Failed) < 0)
+			Ok = false;
+	}
+	if (fclose(File_p) != 0)
+		Ok = false;
+
+	if (!Ok || rename(TmpName, DB_p->FileName_p) != 0) {
+		Do_ADBG_Log("Cannot write duration database %s",
+			    DB_p->FileName_p);
+		(void)remove(TmpName);
+	}
+}
+
+/*************************************************************************
+ * 6. Definitions of internal functions
+ ************************************************************************/
+/* Returns a * b, or UINT64_MAX if it doesn't fit */
+static uint64_t ADBG_Durations_Mul(
+	uint64_t a,
+	uint64_t b
+	)
+{
+	if (b != 0 && a > UINT64_MAX / b)
+		return UINT64_MAX;
+	return a * b;
+}
+
+static ADBG_Duration_t *ADBG_Durations_Find(
+	const char *TestID_p
+	)
+{
+	ADBG_DurationDB_t *DB_p = &ADBG_DurationDB;
+	size_t n;
+
+	for (n = 0; n < DB_p->NumDurations; n++) {
+		if (strcmp(DB_p->Durations_p[n].TestID_p, TestID_p) == 0)
+			return &DB_p->Durations_p[n];
+	}
+	return NULL;
+}
+
+static ADBG_Duration_t *ADBG_Durations_Add(
+	const char *TestID_p
+	)
+{
+	ADBG_DurationDB_t *DB_p = &ADBG_DurationDB;
+	ADBG_Duration_t *Durations_p;
+	ADBG_Duration_t *Duration_p;
+
+	/* A test ID with spaces couldn't be read back */
+	if (strlen(TestID_p) >= ADBG_DURATION_ID_MAX ||
+	    strpbrk(TestID_p, " \t\n") != NULL)
+		return NULL;
+
+	Durations_p = realloc(DB_p->Durations_p,
+			      (DB_p->NumDurations + 1) *
+			      sizeof(ADBG_Duration_t));
+	if (Durations_p == NULL)
+		return NULL;
+	DB_p->Durations_p = Durations_p;
+
+	Duration_p = &Durations_p[DB_p->NumDurations];
+	memset(Duration_p, 0, sizeof(ADBG_Duration_t));
+	Duration_p->TestID_p = strdup(TestID_p);
+	if (Duration_p->TestID_p == NULL)
+		return NULL;
+	DB_p->NumDurations++;
+	return Duration_p;
+}
+
+static int ADBG_Candidate_ComparePriority(
+	const void *a_p,
+	const void *b_p
+	)
+{
+	const ADBG_Candidate_t *a = a_p;
+	const ADBG_Candidate_t *b = b_p;
+	uint64_t a_LastRun = a->Duration_p ? a->Duration_p->LastRun : 0;
+	uint64_t b_LastRun = b->Duration_p ? b->Duration_p->LastRun : 0;
+	bool a_Failed = a->Duration_p && a->Duration_p->Failed;
+	bool b_Failed = b->Duration_p && b->Duration_p->Failed;
+
+	/* Recent failures first, then the cases run least recently */
+	if (a_Failed != b_Failed)
+		return a_Failed ? -1 : 1;
+	if (a_LastRun != b_LastRun)
+		return a_LastRun < b_LastRun ? -1 : 1;
+	return a->SuiteEntry_p < b->SuiteEntry_p ? -1 : 1;
+}
+
+static int ADBG_Candidate_CompareCost(
+	const void *a_p,
+	const void *b_p
+	)
+{
+	const ADBG_Candidate_t *a = a_p;
+	const ADBG_Candidate_t *b = b_p;
+
+	if (a->Cost_us != b->Cost_us)
+		return a->Cost_us > b->Cost_us ? -1 : 1;
+	return a->SuiteEntry_p < b->SuiteEntry_p ? -1 : 1;
+}
@@ -52,8 +52,32 @@ typedef struct ADBG_Result {
 	char const *FirstFailedFile_p;
 	bool AbortTestSuite;
 	const char *WhySkipped_p;
+	int NumCollapsedSubCases; /* Passing subcases no longer in the tree */
+	uint64_t TimedOut_us; /* Case duration when the watchdog fired */
 } ADBG_Result_t;
 
+/*
+ * Bump allocator for the subcases of a case. Memory is only given back
+ * all at once or by rewinding to a mark, everything allocated after the
+ * mark is released.
+ */
+typedef struct ADBG_ArenaChunk ADBG_ArenaChunk_t;
+struct ADBG_ArenaChunk {
+	ADBG_ArenaChunk_t *Prev_p;
+	size_t Size;
+	size_t Used;
+};
+
+typedef struct {
+	ADBG_ArenaChunk_t *Chunk_p;
+	ADBG_ArenaChunk_t *Spare_p; /* Kept when rewinding over a chunk */
+} ADBG_Arena_t;
+
+typedef struct {
+	ADBG_ArenaChunk_t *Chunk_p;
+	size_t Used;
+} ADBG_ArenaMark_t;
+
 TAILQ_HEAD(ADBG_SubCaseHead, ADBG_SubCase);
 typedef struct ADBG_SubCaseHead ADBG_SubCaseHead_t;
 
@@ -62,6 +86,9 @@ struct ADBG_SubCase {
 	char *TestID_p;
 	char *Title_p;
 	ADBG_Result_t Result;
+	uint64_t StartTime_us; /* CLOCK_MONOTONIC, see ADBG_GetTime_us() */
+	uint64_t EndTime_us;
+	ADBG_ArenaMark_t ArenaMark; /* Where this SubCase was allocated */
 	ADBG_SubCase_t *Parent_p; /* The SubCase where this SubCase was added */
 	ADBG_SubCaseHead_t SubCasesList; /* SubCases created in this SubCase*/
 	TAILQ_ENTRY(ADBG_SubCase) Link;
@@ -77,6 +104,14 @@ struct ADBG_Case {
 	ADBG_SuiteData_t *SuiteData_p;
 	ADBG_Result_t Result;
 	TAILQ_ENTRY(ADBG_Case)          Link;
+
+	/* Holds the SubCases with their test IDs and titles */
+	ADBG_Arena_t Arena;
+
+	/* Buffered log output of a detached case */
+	char *LogBuf_p;
+	size_t LogLen;
+	size_t LogSize;
 };
 
 typedef struct {
@@ -104,6 +139,12 @@ ADBG_Case_t *ADBG_Case_New(const ADBG_Case_SuiteEntry_t *SuiteEntry_p,
 
 void ADBG_Case_Delete(ADBG_Case_t *Case_p);
 
+/* Saves the subcases and results of a finished case to File_p */
+bool ADBG_Case_Save(const ADBG_Case_t *Case_p, FILE *File_p);
+
+/* Rebuilds a case saved with ADBG_Case_Save() in a forked process */
+bool ADBG_Case_Load(ADBG_Case_t *Case_p, FILE *File_p);
+
 int ADBG_snprintf(char *Buffer_p, size_t BufferSize, const char *Format_p,
 		  ...) __attribute__((__format__(__printf__, 3, 4)));
 
@@ -113,6 +154,63 @@ int ADBG_vsnprintf(char *Buffer_p, size_t BufferSize, const char *Format_p,
 bool ADBG_TestIDMatches(const char *const TestID_p,
 			const char *const Argument_p);
 
+void *ADBG_Arena_Alloc(ADBG_Arena_t *Arena_p, size_t Size);
+char *ADBG_Arena_StrDup(ADBG_Arena_t *Arena_p, const char *String_p);
+ADBG_ArenaMark_t ADBG_Arena_GetMark(const ADBG_Arena_t *Arena_p);
+void ADBG_Arena_Release(ADBG_Arena_t *Arena_p, ADBG_ArenaMark_t Mark);
+void ADBG_Arena_Free(ADBG_Arena_t *Arena_p);
+
+/* Monotonic time in microseconds, comparable between processes */
+uint64_t ADBG_GetTime_us(void);
+
+/* Streams the results to the reports added with Do_ADBG_AddReport() */
+void ADBG_Report_BeginSuite(const char *SuiteID_p);
+void ADBG_Report_Case(const ADBG_Case_t *Case_p);
+void ADBG_Report_EndSuite(const ADBG_Result_t *Result_p);
+
+/*
+ * Picks and orders the cases to run within the budget of
+ * Do_ADBG_SetBudget(), returns the number of cases left out
+ */
+size_t ADBG_Durations_Select(const ADBG_Case_SuiteEntry_t **Entries_pp,
+			     size_t *NumEntries_p, size_t NumJobs);
+void ADBG_Durations_Update(const ADBG_Case_t *Case_p);
+void ADBG_Durations_Save(void);
+
+/* Repeated runs of Do_ADBG_SetRepeat() and their statistics */
+bool ADBG_Soak_Enabled(void);
+void ADBG_Soak_BeginIteration(size_t Iteration);
+bool ADBG_Soak_Continue(uint64_t Elapsed_us);
+void ADBG_Soak_AddCase(const ADBG_Case_t *Case_p);
+void ADBG_Soak_LogIteration(const ADBG_Result_t *Result_p,
+			    uint64_t Duration_us);
+void ADBG_Soak_LogSummary(uint64_t Duration_us);
+
+/*
+ * Watches the case run by the calling process for the limits of
+ * Do_ADBG_SetWatchdog(). ADBG_Watchdog_EndCase() returns how long the
+ * case had run when it timed out, or 0.
+ */
+void ADBG_Watchdog_BeginCase(const ADBG_Case_t *Case_p);
+uint64_t ADBG_Watchdog_EndCase(void);
+
+/* True if Do_ADBG_SetWatchdog() has set a limit */
+bool ADBG_Watchdog_Enabled(void);
+
+/* Exit status of a forked job the watchdog gave up on */
+#define ADBG_WATCHDOG_EXIT 124
+
+/* Detached case the calling thread logs to, NULL when logging to stdout */
+extern __thread ADBG_Case_t *ADBG_LogCase_p;
+
+void ADBG_LogString(const char *const String_p);
+
+/* Appends to the ring of Do_ADBG_SetAsyncLog(), false if not enabled */
+bool ADBG_AsyncLog_Write(const char *String_p, size_t Len);
+
+/* Called in a forked process, which logs directly again */
+void ADBG_AsyncLog_Disable(void);
+
 #define HEAP_ALLOC(x) ((x *)malloc(sizeof(x)))
 #define HEAP_UNTYPED_ALLOC(x) malloc((x))
 #define HEAP_FREE(x) do { if (*(x) != NULL) { free(*(x)); *(x) = NULL; \
@@ -19,6 +19,7 @@
 /*************************************************************************
  * 2. Definition of external constants and variables
  ************************************************************************/
+__thread ADBG_Case_t *ADBG_LogCase_p;
 
 /*************************************************************************
  * 3. File scope types, constants and variables
@@ -47,10 +48,41 @@ void Do_ADBG_Log(const char *const Format, ...)
 	char buf[ADBG_STRING_LENGTH_MAX];
 
 	va_start(ap, Format);
-	vsnprintf(buf, sizeof(buf), Format, ap);
+	vsnprintf(buf, sizeof(buf) - 1, Format, ap);
 	va_end(ap);
-	printf("%s\n", buf);
-	fflush(stdout);
+	strcat(buf, "\n");
+	ADBG_LogString(buf);
+}
+
+/*
+ * Prints String_p, or appends it to the log buffer of the detached case
+ * the calling thread is running.
+ */
+void ADBG_LogString(const char *const String_p)
+{
+	ADBG_Case_t *Case_p = ADBG_LogCase_p;
+	size_t Len = strlen(String_p);
+
+	if (Case_p == NULL) {
+		if (!ADBG_AsyncLog_Write(String_p, Len)) {
+			printf("%s", String_p);
+			fflush(stdout);
+		}
+		return;
+	}
+
+	if (Case_p->LogLen + Len + 1 > Case_p->LogSize) {
+		size_t Size = MAX(Case_p->LogSize * 2,
+				  Case_p->LogLen + Len + 1);
+		char *Buf_p = realloc(Case_p->LogBuf_p, Size);
+
+		if (Buf_p == NULL)
+			return;
+		Case_p->LogBuf_p = Buf_p;
+		Case_p->LogSize = Size;
+	}
+	memcpy(Case_p->LogBuf_p + Case_p->LogLen, String_p, Len + 1);
+	Case_p->LogLen += Len;
 }
 
 void Do_ADBG_LogHeading(unsigned Level, const char *const Format, ...)
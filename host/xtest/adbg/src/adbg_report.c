@@ -0,0 +1,507 @@
+/*
+ * Copyright (c) 2015, Linaro Limited
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License Version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ */
+
+/*************************************************************************
+ * 1. Includes
+ ************************************************************************/
+#include "adbg_int.h"
+
+#include <inttypes.h>
+#include <time.h>
+#include <unistd.h>
+
+/*************************************************************************
+ * 2. Definition of external constants and variables
+ ************************************************************************/
+
+/*************************************************************************
+ * 3. File scope types, constants and variables
+ ************************************************************************/
+
+typedef struct ADBG_Report ADBG_Report_t;
+
+typedef struct {
+	const char *Name_p;
+	void (*BeginSuite_fp)(ADBG_Report_t *Report_p,
+			      const char *SuiteID_p);
+	void (*Case_fp)(ADBG_Report_t *Report_p, const ADBG_Case_t *Case_p);
+	/* Everything needed to close the document, Result_p is NULL until
+	 * the suite has ended */
+	void (*Trailer_fp)(ADBG_Report_t *Report_p,
+			   const ADBG_Result_t *Result_p,
+			   uint64_t Duration_us);
+} ADBG_ReportFormat_t;
+
+struct ADBG_Report {
+	const ADBG_ReportFormat_t *Format_p;
+	FILE *File_p;
+	size_t NumCases;
+	uint64_t StartTime_us;
+	time_t StartTime;
+	char HostName[64];
+	TAILQ_ENTRY(ADBG_Report) Link;
+};
+
+TAILQ_HEAD(ADBG_ReportHead, ADBG_Report);
+static struct ADBG_ReportHead ADBG_Reports =
+	TAILQ_HEAD_INITIALIZER(ADBG_Reports);
+
+/*************************************************************************
+ * 4. Declaration of file local functions
+ ************************************************************************/
+
+static void ADBG_Report_Commit(ADBG_Report_t *Report_p);
+
+static void ADBG_JUnit_BeginSuite(ADBG_Report_t *Report_p,
+				  const char *SuiteID_p);
+static void ADBG_JUnit_Case(ADBG_Report_t *Report_p,
+			    const ADBG_Case_t *Case_p);
+static void ADBG_JUnit_Trailer(ADBG_Report_t *Report_p,
+			       const ADBG_Result_t *Result_p,
+			       uint64_t Duration_us);
+
+static void ADBG_Json_BeginSuite(ADBG_Report_t *Report_p,
+				 const char *SuiteID_p);
+static void ADBG_Json_Case(ADBG_Report_t *Report_p,
+			   const ADBG_Case_t *Case_p);
+static void ADBG_Json_Trailer(ADBG_Report_t *Report_p,
+			      const ADBG_Result_t *Result_p,
+			      uint64_t Duration_us);
+
+static const ADBG_ReportFormat_t ADBG_ReportFormats[] = {
+	{ "junit", ADBG_JUnit_BeginSuite, ADBG_JUnit_Case,
+	  ADBG_JUnit_Trailer },
+	{ "json", ADBG_Json_BeginSuite, ADBG_Json_Case, ADBG_Json_Trailer },
+};
+
+/*************************************************************************
+ * 5. Definition of external functions
+ ************************************************************************/
+bool Do_ADBG_AddReport(
+	const char *Format_p,
+	const char *FileName_p
+	)
+{
+	const ADBG_ReportFormat_t *ReportFormat_p = NULL;
+	ADBG_Report_t *Report_p;
+	size_t n;
+
+	for (n = 0; n < sizeof(ADBG_ReportFormats) /
+			sizeof(ADBG_ReportFormats[0]); n++) {
+		if (strcmp(ADBG_ReportFormats[n].Name_p, Format_p) == 0)
+			ReportFormat_p = &ADBG_ReportFormats[n];
+	}
+	if (ReportFormat_p == NULL)
+		return false;
+
+	Report_p = HEAP_ALLOC(ADBG_Report_t);
+	if (Report_p == NULL)
+		return false;
+	memset(Report_p, 0, sizeof(ADBG_Report_t));
+	Report_p->Format_p = ReportFormat_p;
+
+	Report_p->File_p = fopen(FileName_p, "w");
+	if (Report_p->File_p == NULL) {
+		HEAP_FREE(&Report_p);
+		return false;
+	}
+
+	TAILQ_INSERT_TAIL(&ADBG_Reports, Report_p, Link);
+	return true;
+}
+
+void ADBG_Report_BeginSuite(
+	const char *SuiteID_p
+	)
+{
+	ADBG_Report_t *Report_p;
+
+	TAILQ_FOREACH(Report_p, &ADBG_Reports, Link) {
+		Report_p->NumCases = 0;
+		Report_p->StartTime_us = ADBG_GetTime_us();
+		Report_p->StartTime = time(NULL);
+		if (gethostname(Report_p->HostName,
+				sizeof(Report_p->HostName)) != 0)
+			strcpy(Report_p->HostName, "localhost");
+		Report_p->HostName[sizeof(Report_p->HostName) - 1] = '\0';
+
+		Report_p->Format_p->BeginSuite_fp(Report_p, SuiteID_p);
+		ADBG_Report_Commit(Report_p);
+	}
+}
+
+void ADBG_Report_Case(
+	const ADBG_Case_t *Case_p
+	)
+{
+	ADBG_Report_t *Report_p;
+
+	if (Case_p->FirstSubCase_p == NULL)
+		return;
+
+	TAILQ_FOREACH(Report_p, &ADBG_Reports, Link) {
+		Report_p->Format_p->Case_fp(Report_p, Case_p);
+		Report_p->NumCases++;
+		ADBG_Report_Commit(Report_p);
+	}
+}
+
+void ADBG_Report_EndSuite(
+	const ADBG_Result_t *Result_p
+	)
+{
+	ADBG_Report_t *Report_p;
+
+	while ((Report_p = TAILQ_FIRST(&ADBG_Reports)) != NULL) {
+		FILE *File_p = Report_p->File_p;
+		long Pos;
+
+		Report_p->Format_p->Trailer_fp(Report_p, Result_p,
+			ADBG_GetTime_us() - Report_p->StartTime_us);
+
+		/* Drop what's left of a longer trailer written earlier */
+		Pos = ftell(File_p);
+		fflush(File_p);
+		if (Pos >= 0)
+			(void)ftruncate(fileno(File_p), Pos);
+		fclose(File_p);
+
+		TAILQ_REMOVE(&ADBG_Reports, Report_p, Link);
+		HEAP_FREE(&Report_p);
+	}
+}
+
+/*************************************************************************
+ * 6. Definitions of internal functions
+ ************************************************************************/
+
+/*
+ * Writes the trailer closing the document and flushes it, then moves
+ * back so the next case overwrites the trailer. The file on disk is thus
+ * complete after each case even if the suite never gets to the end.
+ */
+static void ADBG_Report_Commit(
+	ADBG_Report_t *Report_p
+	)
+{
+	long Pos = ftell(Report_p->File_p);
+
+	/* Not seekable, the trailer is only written at the end */
+	if (Pos < 0) {
+		fflush(Report_p->File_p);
+		return;
+	}
+
+	Report_p->Format_p->Trailer_fp(Report_p, NULL, 0);
+	fflush(Report_p->File_p);
+	(void)fseek(Report_p->File_p, Pos, SEEK_SET);
+}
+
+static bool ADBG_SubCase_Failed(
+	const ADBG_SubCase_t *SubCase_p
+	)
+{
+	return SubCase_p->Result.NumFailedTests +
+	       SubCase_p->Result.NumFailedSubTests > 0;
+}
+
+static uint64_t ADBG_Report_Duration(
+	const ADBG_SubCase_t *SubCase_p
+	)
+{
+	if (SubCase_p->EndTime_us < SubCase_p->StartTime_us)
+		return 0;
+	return SubCase_p->EndTime_us - SubCase_p->StartTime_us;
+}
+
+/* Formats the wall-clock time a subcase started at as ISO 8601 UTC */
+static void ADBG_Report_Timestamp(
+	const ADBG_Report_t *Report_p,
+	uint64_t Time_us,
+	char *Buf_p,
+	size_t BufSize
+	)
+{
+	time_t t = Report_p->StartTime;
+	struct tm tm;
+
+	if (Time_us > Report_p->StartTime_us)
+		t += (Time_us - Report_p->StartTime_us) / 1000000;
+	if (gmtime_r(&t, &tm) == NULL ||
+	    strftime(Buf_p, BufSize, "%Y-%m-%dT%H:%M:%S", &tm) == 0)
+		Buf_p[0] = '\0';
+}
+
+static void ADBG_PutXml(
+	FILE *File_p,
+	const char *String_p
+	)
+{
+	const unsigned char *p;
+
+	for (p = (const unsigned char *)String_p; *p != '\0'; p++) {
+		switch (*p) {
+		case '&':
+			fputs("&amp;", File_p);
+			break;
+		case '<':
+			fputs("&lt;", File_p);
+			break;
+		case '>':
+			fputs("&gt;", File_p);
+			break;
+		case '"':
+			fputs("&quot;", File_p);
+			break;
+		default:
+			/* Control characters aren't allowed in XML 1.0 */
+			if (*p < 0x20 && *p != '\t' && *p != '\n')
+				fputc('?', File_p);
+			else
+				fputc(*p, File_p);
+			break;
+		}
+	}
+}
+
+static void ADBG_PutJson(
+	FILE *File_p,
+	const char *String_p
+	)
+{
+	const unsigned char *p;
+
+	fputc('"', File_p);
+	for (p = (const unsigned char *)String_p; *p != '\0'; p++) {
+		if (*p == '"' || *p == '\\')
+			fprintf(File_p, "\\%c", *p);
+		else if (*p < 0x20)
+			fprintf(File_p, "\\u%04x", *p);
+		else
+			fputc(*p, File_p);
+	}
+	fputc('"', File_p);
+}
+
+/*
+ * JUnit XML, each case is a <testsuite> and each of its subcases,
+ * flattened in the order they ended, a <testcase>. A subcase is
+ * reported as failed when expectations made directly in it failed, the
+ * failures of nested subcases are reported on those.
+ */
+static void ADBG_JUnit_BeginSuite(
+	ADBG_Report_t *Report_p,
+	const char *SuiteID_p
+	)
+{
+	fputs("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n", Report_p->File_p);
+	fputs("<testsuites name=\"", Report_p->File_p);
+	ADBG_PutXml(Report_p->File_p, SuiteID_p);
+	fputs("\">\n", Report_p->File_p);
+}
+
+static void ADBG_JUnit_Failure(
+	FILE *File_p,
+	const ADBG_Result_t *Result_p
+	)
+{
+	fputs("   <failure message=\"", File_p);
+	if (Result_p->TimedOut_us != 0)
+		fprintf(File_p, "timed out after %.3f s, ",
+			Result_p->TimedOut_us / 1e6);
+	fprintf(File_p, "%d of %d checks failed",
+		Result_p->NumFailedTests, Result_p->NumTests);
+	if (Result_p->FirstFailedFile_p != NULL) {
+		fputs(", first error at ", File_p);
+		ADBG_PutXml(File_p, Result_p->FirstFailedFile_p);
+		fprintf(File_p, ":%d", Result_p->FirstFailedRow);
+	}
+	fputs("\"/>\n", File_p);
+}
+
+static void ADBG_JUnit_Case(
+	ADBG_Report_t *Report_p,
+	const ADBG_Case_t *Case_p
+	)
+{
+	FILE *File_p = Report_p->File_p;
+	ADBG_SubCase_Iterator_t Iterator;
+	const ADBG_SubCase_t *SubCase_p;
+	size_t NumSubCases = 0;
+	size_t NumFailures = 0;
+	char Timestamp[32];
+
+	ADBG_Case_IterateSubCase((ADBG_Case_t *)Case_p, &Iterator);
+	while ((SubCase_p = ADBG_Case_NextSubCase(&Iterator)) != NULL) {
+		NumSubCases++;
+		if (SubCase_p->Result.NumFailedTests > 0)
+			NumFailures++;
+	}
+
+	ADBG_Report_Timestamp(Report_p, Case_p->FirstSubCase_p->StartTime_us,
+			      Timestamp, sizeof(Timestamp));
+	fputs(" <testsuite name=\"", File_p);
+	ADBG_PutXml(File_p, Case_p->FirstSubCase_p->TestID_p);
+	fprintf(File_p, "\" tests=\"%zu\" failures=\"%zu\" errors=\"0\"",
+		NumSubCases, NumFailures);
+	fprintf(File_p, " skipped=\"%d\"",
+		Case_p->Result.WhySkipped_p != NULL ? 1 : 0);
+	fprintf(File_p, " time=\"%.3f\" timestamp=\"%s\" hostname=\"",
+		ADBG_Report_Duration(Case_p->FirstSubCase_p) / 1e6,
+		Timestamp);
+	ADBG_PutXml(File_p, Report_p->HostName);
+	fputs("\">\n", File_p);
+
+	ADBG_Case_IterateSubCase((ADBG_Case_t *)Case_p, &Iterator);
+	while ((SubCase_p = ADBG_Case_NextSubCase(&Iterator)) != NULL) {
+		fputs("  <testcase classname=\"", File_p);
+		ADBG_PutXml(File_p, Case_p->FirstSubCase_p->TestID_p);
+		fputs("\" name=\"", File_p);
+		ADBG_PutXml(File_p, SubCase_p->TestID_p);
+		fputc(' ', File_p);
+		ADBG_PutXml(File_p, SubCase_p->Title_p);
+		fprintf(File_p, "\" time=\"%.3f\"",
+			ADBG_Report_Duration(SubCase_p) / 1e6);
+
+		if (Case_p->Result.WhySkipped_p != NULL) {
+			fputs(">\n   <skipped message=\"", File_p);
+			ADBG_PutXml(File_p, Case_p->Result.WhySkipped_p);
+			fputs("\"/>\n  </testcase>\n", File_p);
+		} else if (SubCase_p->Result.NumFailedTests > 0) {
+			fputs(">\n", File_p);
+			ADBG_JUnit_Failure(File_p, &SubCase_p->Result);
+			fputs("  </testcase>\n", File_p);
+		} else {
+			fputs("/>\n", File_p);
+		}
+	}
+	fputs(" </testsuite>\n", File_p);
+}
+
+static void ADBG_JUnit_Trailer(
+	ADBG_Report_t *Report_p,
+	const ADBG_Result_t *Result_p,
+	uint64_t Duration_us
+	)
+{
+	(void)Result_p;
+	(void)Duration_us;
+	fputs("</testsuites>\n", Report_p->File_p);
+}
+
+/*
+ * JSON, the cases are objects holding the tree of their subcases. The
+ * document ends with "complete": false until the suite has ended, then
+ * with the totals of the suite.
+ */
+static void ADBG_Json_BeginSuite(
+	ADBG_Report_t *Report_p,
+	const char *SuiteID_p
+	)
+{
+	char Timestamp[32];
+
+	ADBG_Report_Timestamp(Report_p, Report_p->StartTime_us, Timestamp,
+			      sizeof(Timestamp));
+	fputs("{\n\"suite\": ", Report_p->File_p);
+	ADBG_PutJson(Report_p->File_p, SuiteID_p);
+	fputs(",\n\"hostname\": ", Report_p->File_p);
+	ADBG_PutJson(Report_p->File_p, Report_p->HostName);
+	fprintf(Report_p->File_p, ",\n\"timestamp\": \"%sZ\",\n\"cases\": [",
+		Timestamp);
+}
+
+static void ADBG_Json_SubCase(
+	FILE *File_p,
+	const ADBG_SubCase_t *SubCase_p,
+	const char *WhySkipped_p,
+	unsigned Depth
+	)
+{
+	const ADBG_SubCase_t *s;
+	const char *Result_p = "passed";
+
+	if (WhySkipped_p != NULL)
+		Result_p = "skipped";
+	else if (ADBG_SubCase_Failed(SubCase_p))
+		Result_p = "failed";
+
+	fprintf(File_p, "%*s{\"id\": ", Depth, "");
+	ADBG_PutJson(File_p, SubCase_p->TestID_p);
+	fputs(", \"title\": ", File_p);
+	ADBG_PutJson(File_p, SubCase_p->Title_p);
+	fprintf(File_p, ", \"result\": \"%s\"", Result_p);
+	if (WhySkipped_p != NULL) {
+		fputs(", \"skip_reason\": ", File_p);
+		ADBG_PutJson(File_p, WhySkipped_p);
+	}
+	fprintf(File_p, ", \"duration_us\": %" PRIu64,
+		ADBG_Report_Duration(SubCase_p));
+	fprintf(File_p, ", \"checks\": %d, \"failed_checks\": %d",
+		SubCase_p->Result.NumTests + SubCase_p->Result.NumSubTests,
+		SubCase_p->Result.NumFailedTests +
+		SubCase_p->Result.NumFailedSubTests);
+	if (SubCase_p->Result.NumCollapsedSubCases > 0)
+		fprintf(File_p, ", \"collapsed_subcases\": %d",
+			SubCase_p->Result.NumCollapsedSubCases);
+	if (SubCase_p->Result.TimedOut_us != 0)
+		fprintf(File_p, ", \"timed_out_us\": %" PRIu64,
+			SubCase_p->Result.TimedOut_us);
+	if (SubCase_p->Result.FirstFailedFile_p != NULL) {
+		fputs(", \"first_failure\": {\"file\": ", File_p);
+		ADBG_PutJson(File_p, SubCase_p->Result.FirstFailedFile_p);
+		fprintf(File_p, ", \"line\": %d}",
+			SubCase_p->Result.FirstFailedRow);
+	}
+
+	fputs(", \"subcases\": [", File_p);
+	TAILQ_FOREACH(s, &SubCase_p->SubCasesList, Link) {
+		fputs(s == TAILQ_FIRST(&SubCase_p->SubCasesList) ?
+		      "\n" : ",\n", File_p);
+		ADBG_Json_SubCase(File_p, s, NULL, Depth + 1);
+	}
+	fputs("]}", File_p);
+}
+
+static void ADBG_Json_Case(
+	ADBG_Report_t *Report_p,
+	const ADBG_Case_t *Case_p
+	)
+{
+	fputs(Report_p->NumCases == 0 ? "\n" : ",\n", Report_p->File_p);
+	ADBG_Json_SubCase(Report_p->File_p, Case_p->FirstSubCase_p,
+			  Case_p->Result.WhySkipped_p, 1);
+}
+
+static void ADBG_Json_Trailer(
+	ADBG_Report_t *Report_p,
+	const ADBG_Result_t *Result_p,
+	uint64_t Duration_us
+	)
+{
+	FILE *File_p = Report_p->File_p;
+
+	if (Result_p == NULL) {
+		fputs("\n],\n\"complete\": false\n}\n", File_p);
+		return;
+	}
+
+	fputs("\n],\n\"complete\": true,\n", File_p);
+	fprintf(File_p, "\"aborted\": %s,\n",
+		Result_p->AbortTestSuite ? "true" : "false");
+	fprintf(File_p, "\"duration_us\": %" PRIu64 ",\n", Duration_us);
+	fprintf(File_p, "\"checks\": %d,\n\"failed_checks\": %d,\n",
+		Result_p->NumTests, Result_p->NumFailedTests);
+	fprintf(File_p, "\"num_cases\": %d,\n\"failed_cases\": %d\n}\n",
+		Result_p->NumSubCases, Result_p->NumFailedSubCases);
+}
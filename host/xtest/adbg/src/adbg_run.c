@@ -16,6 +16,12 @@
  ************************************************************************/
 #include "adbg_int.h"
 
+#include <errno.h>
+#include <inttypes.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
 /*************************************************************************
  * 2. Definition of external constants and variables
  ************************************************************************/
@@ -27,20 +33,64 @@
 TAILQ_HEAD(ADBG_CaseHead, ADBG_Case);
 typedef struct ADBG_CaseHead ADBG_CaseHead_t;
 
+/* A case running in a forked process */
+typedef struct ADBG_Job {
+	ADBG_Case_t *Case_p;
+	pid_t Pid;
+	size_t Slot;	/* Passed to ADBG_ForkInit_fp */
+	bool Done;
+	int Status;
+	FILE *Log_p;	/* stdout and stderr of the process */
+	FILE *Result_p;	/* The case as saved by ADBG_Case_Save() */
+	uint64_t StartTime_us;
+	uint64_t EndTime_us;	/* When the process was reaped */
+	TAILQ_ENTRY(ADBG_Job) Link;
+} ADBG_Job_t;
+
+TAILQ_HEAD(ADBG_JobHead, ADBG_Job);
+typedef struct ADBG_JobHead ADBG_JobHead_t;
+
 typedef struct ADBG_Runner {
 	ADBG_Result_t Result;
 	const ADBG_Suite_Definition_t *Suite_p;
 
 	ADBG_SuiteData_t SuiteData;
 	ADBG_CaseHead_t CasesList;
+
+	/* Started jobs in suite order, merged from the head when done */
+	ADBG_JobHead_t JobsList;
+	size_t NumRunningJobs;
 } ADBG_Runner_t;
 
+/* Number of leaf subcases listed in the slowest subcases report */
+#define ADBG_NUM_SLOWEST_SUBCASES 10
+
+static size_t ADBG_NumJobs = 1;
+static void (*ADBG_ForkInit_fp)(size_t Slot);
+static size_t ADBG_ShardIndex;
+static size_t ADBG_NumShards = 1;
+
 /*************************************************************************
  * 4. Declaration of file local functions
  ************************************************************************/
 
 static int ADBG_RunSuite(ADBG_Runner_t *Runner_p, int argc, char *argv[]);
 
+static void ADBG_RunCase(ADBG_Case_t *Case_p);
+
+static void ADBG_SumCase(ADBG_Runner_t *Runner_p, ADBG_Case_t *Case_p);
+
+static bool ADBG_StartJob(ADBG_Runner_t *Runner_p, ADBG_Case_t *Case_p);
+
+static void ADBG_RunJob(ADBG_Job_t *Job_p) __attribute__((noreturn));
+
+static void ADBG_WaitJob(ADBG_Runner_t *Runner_p, pid_t Pid);
+
+static void ADBG_FinishJobs(ADBG_Runner_t *Runner_p, bool WaitAll);
+
+static void ADBG_LogDurations(ADBG_Runner_t *Runner_p,
+			      uint64_t StartTime_us);
+
 
 /*************************************************************************
  * 5. Definition of external functions
@@ -52,6 +102,10 @@ int Do_ADBG_RunSuite(
 	)
 {
 	ADBG_Runner_t *Runner_p;
+	ADBG_Result_t Total;
+	uint64_t StartTime_us = ADBG_GetTime_us();
+	size_t Iteration = 0;
+	int ret = 0;
 
 	Runner_p = HEAP_ALLOC(ADBG_Runner_t);
 	if (Runner_p == NULL) {
@@ -61,13 +115,56 @@ int Do_ADBG_RunSuite(
 	}
 	memset(Runner_p, 0, sizeof(ADBG_Runner_t));
 	TAILQ_INIT(&Runner_p->CasesList);
+	TAILQ_INIT(&Runner_p->JobsList);
 	Runner_p->Suite_p = Suite_p;
+	memset(&Total, 0, sizeof(Total));
+
+	ADBG_Report_BeginSuite(Suite_p->SuiteID_p);
+
+	/* Runs the selected cases once, or repeatedly when soaking */
+	do {
+		uint64_t IterationStart_us = ADBG_GetTime_us();
+		int r;
+
+		ADBG_Soak_BeginIteration(++Iteration);
+		memset(&Runner_p->Result, 0, sizeof(Runner_p->Result));
+		r = ADBG_RunSuite(Runner_p, argc, argv);
+		ADBG_Soak_LogIteration(&Runner_p->Result,
+				       ADBG_GetTime_us() - IterationStart_us);
+		if (r < 0) {
+			ret = r;
+			break;
+		}
+		ret += r;
+
+		Total.NumTests += Runner_p->Result.NumTests;
+		Total.NumFailedTests += Runner_p->Result.NumFailedTests;
+		Total.NumSubCases += Runner_p->Result.NumSubCases;
+		Total.NumFailedSubCases += Runner_p->Result.NumFailedSubCases;
+		Total.AbortTestSuite = Runner_p->Result.AbortTestSuite;
+	} while (!Total.AbortTestSuite &&
+		 ADBG_Soak_Continue(ADBG_GetTime_us() - StartTime_us));
+
+	ADBG_Soak_LogSummary(ADBG_GetTime_us() - StartTime_us);
+	ADBG_Report_EndSuite(&Total);
+	Do_ADBG_FlushLog();
 
-	int ret = ADBG_RunSuite(Runner_p, argc, argv);
 	HEAP_FREE(&Runner_p);
 	return ret;
 }
 
+void Do_ADBG_SetNumJobs(size_t NumJobs, void (*ForkInit_fp)(size_t Slot))
+{
+	ADBG_NumJobs = NumJobs ? NumJobs : 1;
+	ADBG_ForkInit_fp = ForkInit_fp;
+}
+
+void Do_ADBG_SetShard(size_t Index, size_t NumShards)
+{
+	ADBG_NumShards = NumShards ? NumShards : 1;
+	ADBG_ShardIndex = Index % ADBG_NumShards;
+}
+
 /*************************************************************************
  * 6. Definitions of internal functions
  ************************************************************************/
@@ -79,8 +176,13 @@ static int ADBG_RunSuite(
 {
 	size_t n;
 	ADBG_Case_t *Case_p;
+	const ADBG_Case_SuiteEntry_t **Entries_pp;
+	size_t NumEntries = 0;
+	size_t NumLeftOut;
 	size_t NumSkippedTestCases = 0;
+	size_t NumSelected = 0;
 	int failed_test = 0;
+	uint64_t StartTime_us = ADBG_GetTime_us();
 
 	Do_ADBG_Log("######################################################");
 	Do_ADBG_Log("#");
@@ -88,6 +190,17 @@ static int ADBG_RunSuite(
 	Do_ADBG_Log("#");
 	Do_ADBG_Log("######################################################");
 
+	for (n = 0;
+	     Runner_p->Suite_p->SuiteEntries_p[n].CaseDefinition_p != NULL;
+	     n++)
+		;
+	Entries_pp = HEAP_UNTYPED_ALLOC(MAX(n, 1) * sizeof(*Entries_pp));
+	if (Entries_pp == NULL) {
+		Do_ADBG_Log("HEAP_ALLOC failed for Suite %s!",
+			    Runner_p->Suite_p->SuiteID_p);
+		return -1;
+	}
+
 	for (n = 0;
 	     Runner_p->Suite_p->SuiteEntries_p[n].CaseDefinition_p != NULL;
 	     n++) {
@@ -112,6 +225,32 @@ static int ADBG_RunSuite(
 			}
 		}
 
+		/* Cases of the other shards are neither run nor counted */
+		if (NumSelected++ % ADBG_NumShards != ADBG_ShardIndex)
+			continue;
+
+		Entries_pp[NumEntries++] = SuiteEntry_p;
+	}
+
+	NumLeftOut = ADBG_Durations_Select(Entries_pp, &NumEntries,
+					   ADBG_NumJobs);
+
+	for (n = 0; n < NumEntries; n++) {
+		const ADBG_Case_SuiteEntry_t *SuiteEntry_p = Entries_pp[n];
+		bool Parallel = ADBG_NumJobs > 1 && !SuiteEntry_p->Serial;
+
+		if (Parallel) {
+			while (Runner_p->NumRunningJobs >= ADBG_NumJobs) {
+				ADBG_WaitJob(Runner_p, -1);
+				ADBG_FinishJobs(Runner_p, false);
+			}
+		} else {
+			/* Report the cases before this one before it starts */
+			ADBG_FinishJobs(Runner_p, true);
+		}
+		if (Runner_p->Result.AbortTestSuite)
+			break;
+
 		Case_p = ADBG_Case_New(SuiteEntry_p, &Runner_p->SuiteData);
 		if (Case_p == NULL) {
 			Do_ADBG_Log("HEAP_ALLOC failed for Case %s!",
@@ -122,47 +261,35 @@ static int ADBG_RunSuite(
 
 		TAILQ_INSERT_TAIL(&Runner_p->CasesList, Case_p, Link);
 
-		/* Start the parent test case */
-		Do_ADBG_BeginSubCase(Case_p, "%s",
-				     SuiteEntry_p->CaseDefinition_p->Title_p);
-
-		if (SuiteEntry_p->WhyDisabled_p == NULL) {
-			/* Run case */
-			SuiteEntry_p->CaseDefinition_p->Run_fp(Case_p);
-		} else {
+		if (SuiteEntry_p->WhyDisabled_p != NULL)
 			NumSkippedTestCases++;
+
+		/*
+		 * With a watchdog the other cases run in a forked job too,
+		 * alone, so one the watchdog gives up on doesn't end the
+		 * suite.
+		 */
+		if (Parallel || ADBG_Watchdog_Enabled()) {
+			if (ADBG_StartJob(Runner_p, Case_p)) {
+				if (!Parallel)
+					ADBG_FinishJobs(Runner_p, true);
+				if (Runner_p->Result.AbortTestSuite)
+					break;
+				continue;
+			}
+			/* Couldn't fork, run the case in this process */
+			ADBG_FinishJobs(Runner_p, true);
 		}
 
-		/* End abondoned subcases */
-		while (Case_p->CurrentSubCase_p != Case_p->FirstSubCase_p)
-			Do_ADBG_EndSubCase(Case_p, NULL);
-
-		/* End the parent test case */
-		Do_ADBG_EndSubCase(Case_p, "%s",
-				   SuiteEntry_p->CaseDefinition_p->Title_p);
-
-		/* Sum up the errors */
-		Case_p->Result.WhySkipped_p = SuiteEntry_p->WhyDisabled_p;
-		Runner_p->Result.NumTests += Case_p->Result.NumTests +
-					     Case_p->Result.NumSubTests;
-		Runner_p->Result.NumFailedTests +=
-			Case_p->Result.NumFailedTests +
-			Case_p->Result.
-			NumFailedSubTests;
-		Runner_p->Result.NumSubCases++;
-		if (Case_p->Result.NumFailedTests +
-		    Case_p->Result.NumFailedSubTests > 0)
-			Runner_p->Result.NumFailedSubCases++;
-
-		Runner_p->Result.AbortTestSuite = Case_p->Result.AbortTestSuite;
-
-		if (Runner_p->Result.AbortTestSuite) {
-			Do_ADBG_Log("Test suite aborted by %s!",
-				    SuiteEntry_p->CaseDefinition_p->TestID_p);
+		ADBG_RunCase(Case_p);
+		ADBG_SumCase(Runner_p, Case_p);
+		if (Runner_p->Result.AbortTestSuite)
 			break;
-		}
 	}
 
+	ADBG_FinishJobs(Runner_p, true);
+	HEAP_FREE(&Entries_pp);
+
 	if (Runner_p->Suite_p->CleanupSuite_fp != NULL)
 		Runner_p->Suite_p->CleanupSuite_fp(&Runner_p->SuiteData);
 
@@ -178,6 +305,12 @@ static int ADBG_RunSuite(
 		Do_ADBG_Log("Result of testsuite %s:",
 			    Runner_p->Suite_p->SuiteID_p);
 	}
+	if (ADBG_NumShards > 1)
+		Do_ADBG_Log("Shard %zu/%zu", ADBG_ShardIndex,
+			    ADBG_NumShards);
+	if (NumLeftOut > 0)
+		Do_ADBG_Log("%zu test case%s left out by the time budget",
+			    NumLeftOut, NumLeftOut > 1 ? "s" : "");
 
 	TAILQ_FOREACH(Case_p, &Runner_p->CasesList, Link) {
 		ADBG_SubCase_Iterator_t Iterator;
@@ -189,6 +322,11 @@ static int ADBG_RunSuite(
 				Do_ADBG_Log("%s SKIPPED: \"%s\"",
 					    SubCase_p->TestID_p,
 					    Case_p->Result.WhySkipped_p);
+			} else if (SubCase_p->Result.TimedOut_us != 0) {
+				Do_ADBG_Log("%s TIMED OUT after %.3f s",
+					    SubCase_p->TestID_p,
+					    SubCase_p->Result.TimedOut_us /
+					    1e6);
 			} else if (SubCase_p->Result.NumFailedTests +
 				   SubCase_p->Result.NumFailedSubTests > 0) {
 				if (SubCase_p->Result.FirstFailedFile_p !=
@@ -212,6 +350,7 @@ static int ADBG_RunSuite(
 		}
 	}
 
+	ADBG_LogDurations(Runner_p, StartTime_us);
 
 	Do_ADBG_Log("+-----------------------------------------------------");
 	if (Runner_p->Result.AbortTestSuite)
@@ -229,6 +368,9 @@ static int ADBG_RunSuite(
 		    NumSkippedTestCases,
 		    NumSkippedTestCases > 1 ? "s" : "");
 
+	ADBG_Durations_Save();
+	Do_ADBG_FlushLog();
+
 	failed_test = Runner_p->Result.NumFailedSubCases;
 
 	while (true) {
@@ -240,3 +382,354 @@ static int ADBG_RunSuite(
 	}
 	return failed_test;
 }
+
+static void ADBG_RunCase(
+	ADBG_Case_t *Case_p
+	)
+{
+	const ADBG_Case_SuiteEntry_t *SuiteEntry_p = Case_p->SuiteEntry_p;
+	uint64_t TimedOut_us = 0;
+
+	/* Start the parent test case */
+	Do_ADBG_BeginSubCase(Case_p, "%s",
+			     SuiteEntry_p->CaseDefinition_p->Title_p);
+
+	if (SuiteEntry_p->WhyDisabled_p == NULL) {
+		/* Run case */
+		ADBG_Watchdog_BeginCase(Case_p);
+		SuiteEntry_p->CaseDefinition_p->Run_fp(Case_p);
+		TimedOut_us = ADBG_Watchdog_EndCase();
+	}
+
+	/* End abondoned subcases */
+	while (Case_p->CurrentSubCase_p != Case_p->FirstSubCase_p)
+		Do_ADBG_EndSubCase(Case_p, NULL);
+
+	if (TimedOut_us != 0 && Case_p->FirstSubCase_p != NULL) {
+		Case_p->FirstSubCase_p->Result.TimedOut_us = TimedOut_us;
+		(void)ADBG_EXPECT_TRUE(Case_p, false);
+	}
+
+	/* End the parent test case */
+	Do_ADBG_EndSubCase(Case_p, "%s",
+			   SuiteEntry_p->CaseDefinition_p->Title_p);
+}
+
+static void ADBG_SumCase(
+	ADBG_Runner_t *Runner_p,
+	ADBG_Case_t *Case_p
+	)
+{
+	const ADBG_Case_SuiteEntry_t *SuiteEntry_p = Case_p->SuiteEntry_p;
+
+	/* Sum up the errors */
+	Case_p->Result.WhySkipped_p = SuiteEntry_p->WhyDisabled_p;
+	Runner_p->Result.NumTests += Case_p->Result.NumTests +
+				     Case_p->Result.NumSubTests;
+	Runner_p->Result.NumFailedTests +=
+		Case_p->Result.NumFailedTests +
+		Case_p->Result.
+		NumFailedSubTests;
+	Runner_p->Result.NumSubCases++;
+	if (Case_p->Result.NumFailedTests +
+	    Case_p->Result.NumFailedSubTests > 0)
+		Runner_p->Result.NumFailedSubCases++;
+
+	if (Case_p->Result.AbortTestSuite) {
+		Runner_p->Result.AbortTestSuite = true;
+		Do_ADBG_Log("Test suite aborted by %s!",
+			    SuiteEntry_p->CaseDefinition_p->TestID_p);
+	}
+
+	ADBG_Report_Case(Case_p);
+	ADBG_Durations_Update(Case_p);
+	ADBG_Soak_AddCase(Case_p);
+	Do_ADBG_FlushLog();
+}
+
+static void ADBG_Job_Delete(
+	ADBG_Job_t *Job_p
+	)
+{
+	if (Job_p->Log_p != NULL)
+		fclose(Job_p->Log_p);
+	if (Job_p->Result_p != NULL)
+		fclose(Job_p->Result_p);
+	HEAP_FREE(&Job_p);
+}
+
+/* Returns the lowest slot not used by a running job */
+static size_t ADBG_FreeSlot(
+	ADBG_Runner_t *Runner_p
+	)
+{
+	ADBG_Job_t *Job_p;
+	size_t Slot;
+
+	for (Slot = 0; Slot < ADBG_NumJobs; Slot++) {
+		TAILQ_FOREACH(Job_p, &Runner_p->JobsList, Link) {
+			if (!Job_p->Done && Job_p->Slot == Slot)
+				break;
+		}
+		if (Job_p == NULL)
+			break;
+	}
+	return Slot;
+}
+
+static bool ADBG_StartJob(
+	ADBG_Runner_t *Runner_p,
+	ADBG_Case_t *Case_p
+	)
+{
+	ADBG_Job_t *Job_p;
+
+	Job_p = HEAP_ALLOC(ADBG_Job_t);
+	if (Job_p == NULL)
+		return false;
+	memset(Job_p, 0, sizeof(ADBG_Job_t));
+	Job_p->Case_p = Case_p;
+	Job_p->Slot = ADBG_FreeSlot(Runner_p);
+
+	Job_p->Log_p = tmpfile();
+	Job_p->Result_p = tmpfile();
+	if (Job_p->Log_p == NULL || Job_p->Result_p == NULL)
+		goto ErrorReturn;
+
+	/* Output buffered so far would otherwise be printed twice */
+	fflush(stdout);
+	fflush(stderr);
+
+	Job_p->StartTime_us = ADBG_GetTime_us();
+	Job_p->Pid = fork();
+	if (Job_p->Pid < 0)
+		goto ErrorReturn;
+	if (Job_p->Pid == 0)
+		ADBG_RunJob(Job_p);
+
+	TAILQ_INSERT_TAIL(&Runner_p->JobsList, Job_p, Link);
+	Runner_p->NumRunningJobs++;
+	return true;
+
+ErrorReturn:
+	ADBG_Job_Delete(Job_p);
+	return false;
+}
+
+/* Runs in the forked process */
+static void ADBG_RunJob(
+	ADBG_Job_t *Job_p
+	)
+{
+	int Ret = 1;
+
+	ADBG_AsyncLog_Disable();
+	if (dup2(fileno(Job_p->Log_p), STDOUT_FILENO) < 0 ||
+	    dup2(fileno(Job_p->Log_p), STDERR_FILENO) < 0)
+		_exit(Ret);
+
+	if (ADBG_ForkInit_fp != NULL)
+		ADBG_ForkInit_fp(Job_p->Slot);
+
+	ADBG_RunCase(Job_p->Case_p);
+
+	if (ADBG_Case_Save(Job_p->Case_p, Job_p->Result_p) &&
+	    fflush(Job_p->Result_p) == 0)
+		Ret = 0;
+
+	fflush(stdout);
+	fflush(stderr);
+	_exit(Ret);
+}
+
+/* Waits for the job with Pid, or any job if Pid is -1, to exit */
+static void ADBG_WaitJob(
+	ADBG_Runner_t *Runner_p,
+	pid_t Pid
+	)
+{
+	ADBG_Job_t *Job_p;
+	int Status = 0;
+	pid_t Res;
+
+	do {
+		Res = waitpid(Pid, &Status, 0);
+	} while (Res < 0 && errno == EINTR);
+
+	TAILQ_FOREACH(Job_p, &Runner_p->JobsList, Link) {
+		if (Job_p->Done)
+			continue;
+		/* If waitpid() failed there's nothing left to wait for */
+		if (Res < 0 || Job_p->Pid == Res) {
+			Job_p->Done = true;
+			Job_p->Status = Res < 0 ? -1 : Status;
+			Job_p->EndTime_us = ADBG_GetTime_us();
+			Runner_p->NumRunningJobs--;
+			if (Res >= 0)
+				break;
+		}
+	}
+}
+
+static void ADBG_FinishJob(
+	ADBG_Runner_t *Runner_p,
+	ADBG_Job_t *Job_p
+	)
+{
+	ADBG_Case_t *Case_p = Job_p->Case_p;
+	const ADBG_Case_Definition_t *CaseDefinition_p =
+		Case_p->SuiteEntry_p->CaseDefinition_p;
+	char Buf[256];
+	size_t Len;
+
+	if (!Job_p->Done)
+		ADBG_WaitJob(Runner_p, Job_p->Pid);
+
+	rewind(Job_p->Log_p);
+	while ((Len = fread(Buf, 1, sizeof(Buf) - 1, Job_p->Log_p)) > 0) {
+		Buf[Len] = '\0';
+		ADBG_LogString(Buf);
+	}
+
+	rewind(Job_p->Result_p);
+	if (!WIFEXITED(Job_p->Status) || WEXITSTATUS(Job_p->Status) != 0 ||
+	    !ADBG_Case_Load(Case_p, Job_p->Result_p)) {
+		/* The process died before the case finished */
+		Do_ADBG_BeginSubCase(Case_p, "%s", CaseDefinition_p->Title_p);
+		if (WIFSIGNALED(Job_p->Status))
+			Do_ADBG_Log("%s: process killed by signal %d",
+				    CaseDefinition_p->TestID_p,
+				    WTERMSIG(Job_p->Status));
+		else if (WIFEXITED(Job_p->Status) &&
+			 WEXITSTATUS(Job_p->Status) == ADBG_WATCHDOG_EXIT &&
+			 Case_p->CurrentSubCase_p != NULL)
+			/* The watchdog gave up on the case, and said so */
+			Case_p->CurrentSubCase_p->Result.TimedOut_us =
+				Job_p->EndTime_us - Job_p->StartTime_us;
+		else
+			Do_ADBG_Log("%s: process exited without a result",
+				    CaseDefinition_p->TestID_p);
+		(void)ADBG_EXPECT_TRUE(Case_p, false);
+		Do_ADBG_EndSubCase(Case_p, "%s", CaseDefinition_p->Title_p);
+		if (Case_p->FirstSubCase_p != NULL) {
+			/* Timed as long as the process ran */
+			Case_p->FirstSubCase_p->StartTime_us =
+				Job_p->StartTime_us;
+			Case_p->FirstSubCase_p->EndTime_us = Job_p->EndTime_us;
+		}
+	}
+
+	ADBG_SumCase(Runner_p, Case_p);
+	TAILQ_REMOVE(&Runner_p->JobsList, Job_p, Link);
+	ADBG_Job_Delete(Job_p);
+}
+
+/*
+ * Reports finished jobs in suite order, stopping at the first one still
+ * running unless WaitAll is set.
+ */
+static void ADBG_FinishJobs(
+	ADBG_Runner_t *Runner_p,
+	bool WaitAll
+	)
+{
+	ADBG_Job_t *Job_p;
+
+	while ((Job_p = TAILQ_FIRST(&Runner_p->JobsList)) != NULL) {
+		if (!Job_p->Done && !WaitAll)
+			break;
+		ADBG_FinishJob(Runner_p, Job_p);
+	}
+}
+
+static uint64_t ADBG_SubCase_Duration(
+	const ADBG_SubCase_t *SubCase_p
+	)
+{
+	if (SubCase_p->EndTime_us < SubCase_p->StartTime_us)
+		return 0;
+	return SubCase_p->EndTime_us - SubCase_p->StartTime_us;
+}
+
+static void ADBG_FormatDuration(
+	char *Buf_p,
+	size_t BufSize,
+	uint64_t Duration_us
+	)
+{
+	(void)ADBG_snprintf(Buf_p, BufSize, "%4" PRIu64 ".%03" PRIu64 " s",
+			    Duration_us / 1000000,
+			    (Duration_us / 1000) % 1000);
+}
+
+/* Keeps Slowest_pp sorted with the longest running subcase first */
+static void ADBG_AddSlowest(
+	const ADBG_SubCase_t **Slowest_pp,
+	size_t *NumSlowest_p,
+	const ADBG_SubCase_t *SubCase_p
+	)
+{
+	uint64_t Duration_us = ADBG_SubCase_Duration(SubCase_p);
+	size_t n = *NumSlowest_p;
+
+	if (n == ADBG_NUM_SLOWEST_SUBCASES) {
+		if (Duration_us <= ADBG_SubCase_Duration(Slowest_pp[n - 1]))
+			return;
+		n--;
+	} else {
+		(*NumSlowest_p)++;
+	}
+
+	while (n > 0 &&
+	       ADBG_SubCase_Duration(Slowest_pp[n - 1]) < Duration_us) {
+		Slowest_pp[n] = Slowest_pp[n - 1];
+		n--;
+	}
+	Slowest_pp[n] = SubCase_p;
+}
+
+static void ADBG_LogDurations(
+	ADBG_Runner_t *Runner_p,
+	uint64_t StartTime_us
+	)
+{
+	const ADBG_SubCase_t *Slowest_p[ADBG_NUM_SLOWEST_SUBCASES];
+	size_t NumSlowest = 0;
+	ADBG_Case_t *Case_p;
+	char Duration[32];
+	size_t n;
+
+	Do_ADBG_Log("+-----------------------------------------------------");
+	Do_ADBG_Log("Duration of test cases:");
+	TAILQ_FOREACH(Case_p, &Runner_p->CasesList, Link) {
+		ADBG_SubCase_Iterator_t Iterator;
+		ADBG_SubCase_t *SubCase_p;
+
+		ADBG_Case_IterateSubCase(Case_p, &Iterator);
+		while ((SubCase_p = ADBG_Case_NextSubCase(&Iterator)) != NULL) {
+			if (ADBG_Case_SubCaseIsMain(Case_p, SubCase_p)) {
+				ADBG_FormatDuration(Duration, sizeof(Duration),
+					ADBG_SubCase_Duration(SubCase_p));
+				Do_ADBG_Log("%-24s %s", SubCase_p->TestID_p,
+					    Duration);
+			} else if (TAILQ_EMPTY(&SubCase_p->SubCasesList)) {
+				ADBG_AddSlowest(Slowest_p, &NumSlowest,
+						SubCase_p);
+			}
+		}
+	}
+
+	if (NumSlowest > 0) {
+		Do_ADBG_Log("Slowest subcases:");
+		for (n = 0; n < NumSlowest; n++) {
+			ADBG_FormatDuration(Duration, sizeof(Duration),
+				ADBG_SubCase_Duration(Slowest_p[n]));
+			Do_ADBG_Log("%-24s %s %s", Slowest_p[n]->TestID_p,
+				    Duration, Slowest_p[n]->Title_p);
+		}
+	}
+
+	ADBG_FormatDuration(Duration, sizeof(Duration),
+			    ADBG_GetTime_us() - StartTime_us);
+	Do_ADBG_Log("Total duration %s", Duration);
+}
@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2015, Linaro Limited
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License Version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ */
+
+/*************************************************************************
+ * 1. Includes
+ ************************************************************************/
+#include "adbg_int.h"
+
+#include <inttypes.h>
+
+/*************************************************************************
+ * 2. Definition of external constants and variables
+ ************************************************************************/
+
+/*************************************************************************
+ * 3. File scope types, constants and variables
+ ************************************************************************/
+
+/* Runs of a case averaged into the duration others are compared with */
+#define ADBG_SOAK_BASELINE_RUNS 5
+/* Weight of the latest run in the moving average of recent runs */
+#define ADBG_SOAK_RECENT_WEIGHT 0.1
+/* A case drifts when its recent average is this much over the baseline */
+#define ADBG_SOAK_DRIFT_PERCENT 20
+#define ADBG_SOAK_DRIFT_MIN_MS 1.0
+
+/*
+ * Statistics of a case over all iterations, kept in constant space so a
+ * soak can run for weeks.
+ */
+typedef struct {
+	const char *TestID_p;
+	uint64_t NumRuns;
+	uint64_t NumFailed;
+	double Min_ms;
+	double Max_ms;
+	double Sum_ms;
+	double Baseline_ms;
+	double Recent_ms;
+	/* Least squares fit of the duration over the iterations */
+	double SumX;
+	double SumY;
+	double SumXX;
+	double SumXY;
+} ADBG_SoakCase_t;
+
+typedef struct {
+	size_t NumIterations;	/* 0 if not limited by count */
+	uint64_t Duration_us;	/* 0 if not limited by time */
+	size_t Iteration;
+	size_t NumFailedIterations;
+	ADBG_SoakCase_t *Cases_p;
+	size_t NumCases;
+} ADBG_Soak_t;
+
+static ADBG_Soak_t ADBG_Soak;
+
+/*************************************************************************
+ * 4. Declaration of file local functions
+ ************************************************************************/
+
+static ADBG_SoakCase_t *ADBG_Soak_FindCase(const char *TestID_p);
+
+static double ADBG_SoakCase_Drift(const ADBG_SoakCase_t *SoakCase_p);
+
+/*************************************************************************
+ * 5. Definition of external functions
+ ************************************************************************/
+void Do_ADBG_SetRepeat(
+	size_t NumIterations,
+	uint64_t Duration_us
+	)
+{
+	ADBG_Soak.NumIterations = NumIterations;
+	ADBG_Soak.Duration_us = Duration_us;
+}
+
+bool ADBG_Soak_Enabled(void)
+{
+	return ADBG_Soak.NumIterations > 1 || ADBG_Soak.Duration_us != 0;
+}
+
+void ADBG_Soak_BeginIteration(
+	size_t Iteration
+	)
+{
+	ADBG_Soak.Iteration = Iteration;
+}
+
+bool ADBG_Soak_Continue(
+	uint64_t Elapsed_us
+	)
+{
+	if (!ADBG_Soak_Enabled())
+		return false;
+	if (ADBG_Soak.NumIterations != 0 &&
+	    ADBG_Soak.Iteration >= ADBG_Soak.NumIterations)
+		return false;
+	if (ADBG_Soak.Duration_us != 0 && Elapsed_us >= ADBG_Soak.Duration_us)
+		return false;
+	return true;
+}
+
+void ADBG_Soak_AddCase(
+	const ADBG_Case_t *Case_p
+	)
+{
+	const ADBG_SubCase_t *SubCase_p = Case_p->FirstSubCase_p;
+	ADBG_SoakCase_t *SoakCase_p;
+	double x = ADBG_Soak.Iteration;
+	double y;
+
+	if (!ADBG_Soak_Enabled() || SubCase_p == NULL ||
+	    Case_p->Result.WhySkipped_p != NULL)
+		return;
+
+	SoakCase_p = ADBG_Soak_FindCase(
+		Case_p->SuiteEntry_p->CaseDefinition_p->TestID_p);
+	if (SoakCase_p == NULL)
+		return;
+
+	y = 0;
+	if (SubCase_p->EndTime_us > SubCase_p->StartTime_us)
+		y = (SubCase_p->EndTime_us - SubCase_p->StartTime_us) / 1000.0;
+
+	if (SoakCase_p->NumRuns == 0 || y < SoakCase_p->Min_ms)
+		SoakCase_p->Min_ms = y;
+	if (y > SoakCase_p->Max_ms)
+		SoakCase_p->Max_ms = y;
+	SoakCase_p->NumRuns++;
+	if (Case_p->Result.NumFailedTests +
+	    Case_p->Result.NumFailedSubTests > 0)
+		SoakCase_p->NumFailed++;
+	SoakCase_p->Sum_ms += y;
+
+	if (SoakCase_p->NumRuns <= ADBG_SOAK_BASELINE_RUNS) {
+		SoakCase_p->Baseline_ms = SoakCase_p->Sum_ms /
+					  SoakCase_p->NumRuns;
+		SoakCase_p->Recent_ms = SoakCase_p->Baseline_ms;
+	} else {
+		SoakCase_p->Recent_ms += ADBG_SOAK_RECENT_WEIGHT *
+					 (y - SoakCase_p->Recent_ms);
+	}
+
+	SoakCase_p->SumX += x;
+	SoakCase_p->SumY += y;
+	SoakCase_p->SumXX += x * x;
+	SoakCase_p->SumXY += x * y;
+}
+
+void ADBG_Soak_LogIteration(
+	const ADBG_Result_t *Result_p,
+	uint64_t Duration_us
+	)
+{
+	size_t NumDrifting = 0;
+	size_t n;
+
+	if (!ADBG_Soak_Enabled())
+		return;
+
+	if (Result_p->NumFailedSubCases > 0)
+		ADBG_Soak.NumFailedIterations++;
+	for (n = 0; n < ADBG_Soak.NumCases; n++) {
+		if (ADBG_SoakCase_Drift(&ADBG_Soak.Cases_p[n]) > 0)
+			NumDrifting++;
+	}
+
+	Do_ADBG_Log("Iteration %zu: %d of %d test cases failed in %.3f s, "
+		    "%zu drifting", ADBG_Soak.Iteration,
+		    Result_p->NumFailedSubCases, Result_p->NumSubCases,
+		    Duration_us / 1e6, NumDrifting);
+}
+
+void ADBG_Soak_LogSummary(
+	uint64_t Duration_us
+	)
+{
+	size_t NumDrifting = 0;
+	size_t n;
+
+	if (!ADBG_Soak_Enabled())
+		return;
+
+	Do_ADBG_Log("+-----------------------------------------------------");
+	Do_ADBG_Log("Soak result of %zu iterations in %.3f s, "
+		    "%zu with failures:", ADBG_Soak.Iteration, Duration_us / 1e6,
+		    ADBG_Soak.NumFailedIterations);
+	Do_ADBG_Log("%-24s %6s %6s %9s %9s %9s %6s", "Test case", "runs",
+		    "fails", "min ms", "avg ms", "max ms", "drift");
+	for (n = 0; n < ADBG_Soak.NumCases; n++) {
+		const ADBG_SoakCase_t *s = &ADBG_Soak.Cases_p[n];
+		double Change = 0;
+
+		if (s->Baseline_ms > 0)
+			Change = 100 * (s->Recent_ms - s->Baseline_ms) /
+				 s->Baseline_ms;
+		Do_ADBG_Log("%-24s %6" PRIu64 " %6" PRIu64
+			    " %9.1f %9.1f %9.1f %+5.0f%%",
+			    s->TestID_p, s->NumRuns, s->NumFailed, s->Min_ms,
+			    s->Sum_ms / s->NumRuns, s->Max_ms, Change);
+		if (ADBG_SoakCase_Drift(s) > 0)
+			NumDrifting++;
+	}
+
+	if (NumDrifting == 0)
+		return;
+
+	Do_ADBG_Log("Drifting test cases, recent runs %d%% slower than the "
+		    "first %d and rising:", ADBG_SOAK_DRIFT_PERCENT,
+		    ADBG_SOAK_BASELINE_RUNS);
+	for (n = 0; n < ADBG_Soak.NumCases; n++) {
+		const ADBG_SoakCase_t *s = &ADBG_Soak.Cases_p[n];
+		double Slope = ADBG_SoakCase_Drift(s);
+
+		if (Slope > 0)
+			Do_ADBG_Log("%-24s %.1f ms -> %.1f ms, %+.3f ms per "
+				    "iteration", s->TestID_p, s->Baseline_ms,
+				    s->Recent_ms, Slope);
+	}
+}
+
+/*************************************************************************
+ * 6. Definitions of internal functions
+ ************************************************************************/
+static ADBG_SoakCase_t *ADBG_Soak_FindCase(
+	const char *TestID_p
+	)
+{
+	ADBG_SoakCase_t *Cases_p;
+	size_t n;
+
+	for (n = 0; n < ADBG_Soak.NumCases; n++) {
+		if (strcmp(ADBG_Soak.Cases_p[n].TestID_p, TestID_p) == 0)
+			return &ADBG_Soak.Cases_p[n];
+	}
+
+	Cases_p = realloc(ADBG_Soak.Cases_p,
+			  (ADBG_Soak.NumCases + 1) * sizeof(ADBG_SoakCase_t));
+	if (Cases_p == NULL)
+		return NULL;
+	ADBG_Soak.Cases_p = Cases_p;
+	Cases_p += ADBG_Soak.NumCases++;
+	memset(Cases_p, 0, sizeof(ADBG_SoakCase_t));
+	Cases_p->TestID_p = TestID_p;
+	return Cases_p;
+}
+
+/*
+ * Returns the slope of the duration in ms per iteration if the case has
+ * got slower since its first runs and is still getting slower, else 0.
+ */
+static double ADBG_SoakCase_Drift(
+	const ADBG_SoakCase_t *SoakCase_p
+	)
+{
+	double n = SoakCase_p->NumRuns;
+	double Den;
+	double Slope;
+
+	if (SoakCase_p->NumRuns < 2 * ADBG_SOAK_BASELINE_RUNS)
+		return 0;
+	if (SoakCase_p->Recent_ms - SoakCase_p->Baseline_ms <
+	    MAX(ADBG_SOAK_DRIFT_MIN_MS,
+		SoakCase_p->Baseline_ms * ADBG_SOAK_DRIFT_PERCENT / 100))
+		return 0;
+
+	Den = n * SoakCase_p->SumXX - SoakCase_p->SumX * SoakCase_p->SumX;
+	if (Den <= 0)
+		return 0;
+	Slope = (n * SoakCase_p->SumXY -
+		 SoakCase_p->SumX * SoakCase_p->SumY) / Den;
+	return Slope > 0 ? Slope : 0;
+}
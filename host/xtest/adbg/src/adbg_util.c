@@ -16,6 +16,8 @@
  ************************************************************************/
 #include "adbg_int.h"
 
+#include <time.h>
+
 /*************************************************************************
  * 2. Definition of external constants and variables
  ************************************************************************/
@@ -24,6 +26,12 @@
  * 3. File scope types, constants and variables
  ************************************************************************/
 
+#define ADBG_ARENA_CHUNK_SIZE (16 * 1024)
+#define ADBG_ARENA_ALIGN 8
+#define ADBG_ARENA_ROUNDUP(x) \
+	(((x) + ADBG_ARENA_ALIGN - 1) & ~(size_t)(ADBG_ARENA_ALIGN - 1))
+#define ADBG_ARENA_HEADER_SIZE ADBG_ARENA_ROUNDUP(sizeof(ADBG_ArenaChunk_t))
+
 /*************************************************************************
  * 4. Declaration of file local functions
  ************************************************************************/
@@ -42,6 +50,101 @@ bool ADBG_TestIDMatches(
 	return strstr(TestID_p, Argument_p) != NULL;
 }
 
+uint64_t ADBG_GetTime_us(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+void *ADBG_Arena_Alloc(
+	ADBG_Arena_t *Arena_p,
+	size_t Size
+	)
+{
+	ADBG_ArenaChunk_t *Chunk_p = Arena_p->Chunk_p;
+	void *Mem_p;
+
+	Size = ADBG_ARENA_ROUNDUP(Size);
+	if (Chunk_p == NULL || Chunk_p->Size - Chunk_p->Used < Size) {
+		size_t ChunkSize = MAX(Size, ADBG_ARENA_CHUNK_SIZE);
+
+		if (ChunkSize == ADBG_ARENA_CHUNK_SIZE &&
+		    Arena_p->Spare_p != NULL) {
+			Chunk_p = Arena_p->Spare_p;
+			Arena_p->Spare_p = NULL;
+		} else {
+			Chunk_p = HEAP_UNTYPED_ALLOC(ADBG_ARENA_HEADER_SIZE +
+						     ChunkSize);
+			if (Chunk_p == NULL)
+				return NULL;
+			Chunk_p->Size = ChunkSize;
+		}
+		Chunk_p->Used = 0;
+		Chunk_p->Prev_p = Arena_p->Chunk_p;
+		Arena_p->Chunk_p = Chunk_p;
+	}
+
+	Mem_p = (uint8_t *)Chunk_p + ADBG_ARENA_HEADER_SIZE + Chunk_p->Used;
+	Chunk_p->Used += Size;
+	return Mem_p;
+}
+
+char *ADBG_Arena_StrDup(
+	ADBG_Arena_t *Arena_p,
+	const char *String_p
+	)
+{
+	size_t Size = strlen(String_p) + 1;
+	char *Copy_p = ADBG_Arena_Alloc(Arena_p, Size);
+
+	if (Copy_p != NULL)
+		memcpy(Copy_p, String_p, Size);
+	return Copy_p;
+}
+
+ADBG_ArenaMark_t ADBG_Arena_GetMark(
+	const ADBG_Arena_t *Arena_p
+	)
+{
+	ADBG_ArenaMark_t Mark;
+
+	Mark.Chunk_p = Arena_p->Chunk_p;
+	Mark.Used = Arena_p->Chunk_p ? Arena_p->Chunk_p->Used : 0;
+	return Mark;
+}
+
+void ADBG_Arena_Release(
+	ADBG_Arena_t *Arena_p,
+	ADBG_ArenaMark_t Mark
+	)
+{
+	while (Arena_p->Chunk_p != Mark.Chunk_p) {
+		ADBG_ArenaChunk_t *Chunk_p = Arena_p->Chunk_p;
+
+		Arena_p->Chunk_p = Chunk_p->Prev_p;
+		/* Saves a free and a malloc when going back and forth */
+		if (Arena_p->Spare_p == NULL &&
+		    Chunk_p->Size == ADBG_ARENA_CHUNK_SIZE)
+			Arena_p->Spare_p = Chunk_p;
+		else
+			HEAP_FREE(&Chunk_p);
+	}
+	if (Arena_p->Chunk_p != NULL)
+		Arena_p->Chunk_p->Used = Mark.Used;
+}
+
+void ADBG_Arena_Free(
+	ADBG_Arena_t *Arena_p
+	)
+{
+	ADBG_ArenaMark_t Empty = { NULL, 0 };
+
+	ADBG_Arena_Release(Arena_p, Empty);
+	HEAP_FREE(&Arena_p->Spare_p);
+}
+
 void *ADBG_ListMemAllocFunction(size_t Length)
 {
 	return HEAP_UNTYPED_ALLOC(Length);
@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2015, Linaro Limited
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License Version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ */
+
+/*************************************************************************
+ * 1. Includes
+ ************************************************************************/
+#include "adbg_int.h"
+
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+/*************************************************************************
+ * 2. Definition of external constants and variables
+ ************************************************************************/
+
+/*************************************************************************
+ * 3. File scope types, constants and variables
+ ************************************************************************/
+
+/* How often the limits are checked */
+#define ADBG_WATCHDOG_POLL_MS 100
+
+/* How long a cancelled case gets to return before it's given up on */
+#define ADBG_WATCHDOG_GRACE_US (10 * 1000000ULL)
+
+/*
+ * Operations in flight at the same time, from all threads of a case.
+ * Operations started when the table is full are only covered by the
+ * limit of the case.
+ */
+#define ADBG_WATCHDOG_MAX_OPS 64
+
+typedef struct {
+	void *Op_p;		/* NULL if the entry is free */
+	uint64_t StartTime_us;
+	bool Cancelled;
+} ADBG_WatchedOp_t;
+
+typedef struct {
+	uint64_t CaseLimit_us;	/* 0 if cases aren't limited */
+	uint64_t OpLimit_us;	/* 0 if operations aren't limited */
+	void (*Cancel_fp)(void *Op_p);
+	pid_t MainPid;		/* Process running the suite */
+	pid_t Pid;		/* Process owning the watchdog thread */
+	pthread_mutex_t Mutex;
+	/* Below protected by Mutex */
+	const char *TestID_p;	/* NULL between cases */
+	uint64_t CaseStartTime_us;
+	uint64_t TimedOut_us;	/* Case duration when a limit was hit */
+	uint64_t GiveUpTime_us;
+	ADBG_WatchedOp_t Ops[ADBG_WATCHDOG_MAX_OPS];
+} ADBG_Watchdog_t;
+
+static ADBG_Watchdog_t ADBG_Watchdog = {
+	.Mutex = PTHREAD_MUTEX_INITIALIZER,
+};
+
+/*************************************************************************
+ * 4. Declaration of file local functions
+ ************************************************************************/
+
+static void *ADBG_Watchdog_Thread(void *Arg_p);
+
+static void ADBG_Watchdog_Check(ADBG_Watchdog_t *Watchdog_p);
+
+static void ADBG_Watchdog_Lock(void);
+
+static void ADBG_Watchdog_Unlock(void);
+
+/*************************************************************************
+ * 5. Definition of external functions
+ ************************************************************************/
+void Do_ADBG_SetWatchdog(
+	uint64_t CaseLimit_us,
+	uint64_t OpLimit_us,
+	void (*Cancel_fp)(void *Op_p)
+	)
+{
+	ADBG_Watchdog_t *Watchdog_p = &ADBG_Watchdog;
+
+	if (Watchdog_p->MainPid == 0 &&
+	    pthread_atfork(ADBG_Watchdog_Lock, ADBG_Watchdog_Unlock,
+			   ADBG_Watchdog_Unlock) != 0)
+		return;
+
+	Watchdog_p->CaseLimit_us = CaseLimit_us;
+	Watchdog_p->OpLimit_us = OpLimit_us;
+	Watchdog_p->Cancel_fp = Cancel_fp;
+	Watchdog_p->MainPid = getpid();
+}
+
+void Do_ADBG_WatchOp(
+	void *Op_p
+	)
+{
+	ADBG_Watchdog_t *Watchdog_p = &ADBG_Watchdog;
+	size_t n;
+
+	if (Watchdog_p->Cancel_fp == NULL || Op_p == NULL)
+		return;
+
+	pthread_mutex_lock(&Watchdog_p->Mutex);
+	for (n = 0; n < ADBG_WATCHDOG_MAX_OPS; n++) {
+		if (Watchdog_p->Ops[n].Op_p == NULL) {
+			Watchdog_p->Ops[n].Op_p = Op_p;
+			Watchdog_p->Ops[n].StartTime_us = ADBG_GetTime_us();
+			Watchdog_p->Ops[n].Cancelled = false;
+			break;
+		}
+	}
+	pthread_mutex_unlock(&Watchdog_p->Mutex);
+}
+
+void Do_ADBG_UnwatchOp(
+	void *Op_p
+	)
+{
+	ADBG_Watchdog_t *Watchdog_p = &ADBG_Watchdog;
+	size_t n;
+
+	if (Watchdog_p->Cancel_fp == NULL || Op_p == NULL)
+		return;
+
+	pthread_mutex_lock(&Watchdog_p->Mutex);
+	for (n = 0; n < ADBG_WATCHDOG_MAX_OPS; n++) {
+		if (Watchdog_p->Ops[n].Op_p == Op_p) {
+			Watchdog_p->Ops[n].Op_p = NULL;
+			break;
+		}
+	}
+	pthread_mutex_unlock(&Watchdog_p->Mutex);
+}
+
+void ADBG_Watchdog_BeginCase(
+	const ADBG_Case_t *Case_p
+	)
+{
+	ADBG_Watchdog_t *Watchdog_p = &ADBG_Watchdog;
+	pthread_t Thread;
+
+	if (!ADBG_Watchdog_Enabled())
+		return;
+
+	/* Started in each process as threads don't survive a fork() */
+	if (Watchdog_p->Pid != getpid()) {
+		if (pthread_create(&Thread, NULL, ADBG_Watchdog_Thread,
+				   Watchdog_p) != 0) {
+			Do_ADBG_Log("Cannot start the watchdog thread");
+			return;
+		}
+		(void)pthread_detach(Thread);
+		Watchdog_p->Pid = getpid();
+	}
+
+	pthread_mutex_lock(&Watchdog_p->Mutex);
+	memset(Watchdog_p->Ops, 0, sizeof(Watchdog_p->Ops));
+	Watchdog_p->TestID_p = Case_p->SuiteEntry_p->CaseDefinition_p->TestID_p;
+	Watchdog_p->CaseStartTime_us = ADBG_GetTime_us();
+	Watchdog_p->TimedOut_us = 0;
+	pthread_mutex_unlock(&Watchdog_p->Mutex);
+}
+
+bool ADBG_Watchdog_Enabled(void)
+{
+	const ADBG_Watchdog_t *Watchdog_p = &ADBG_Watchdog;
+
+	return Watchdog_p->Cancel_fp != NULL &&
+	       (Watchdog_p->CaseLimit_us != 0 || Watchdog_p->OpLimit_us != 0);
+}
+
+uint64_t ADBG_Watchdog_EndCase(void)
+{
+	ADBG_Watchdog_t *Watchdog_p = &ADBG_Watchdog;
+	uint64_t TimedOut_us;
+
+	if (Watchdog_p->Pid != getpid())
+		return 0;
+
+	pthread_mutex_lock(&Watchdog_p->Mutex);
+	TimedOut_us = Watchdog_p->TimedOut_us;
+	Watchdog_p->TestID_p = NULL;
+	Watchdog_p->TimedOut_us = 0;
+	pthread_mutex_unlock(&Watchdog_p->Mutex);
+	return TimedOut_us;
+}
+
+/*************************************************************************
+ * 6. Definitions of internal functions
+ ************************************************************************/
+static void *ADBG_Watchdog_Thread(
+	void *Arg_p
+	)
+{
+	ADBG_Watchdog_t *Watchdog_p = Arg_p;
+	const struct timespec Poll = {
+		.tv_nsec = ADBG_WATCHDOG_POLL_MS * 1000000,
+	};
+
+	while (true) {
+		(void)nanosleep(&Poll, NULL);
+		pthread_mutex_lock(&Watchdog_p->Mutex);
+		ADBG_Watchdog_Check(Watchdog_p);
+		pthread_mutex_unlock(&Watchdog_p->Mutex);
+	}
+	return NULL;
+}
+
+/*
+ * Once a limit is hit the case is timed out and each of its operations
+ * in flight, or started later, is cancelled. Cancel_fp is called with
+ * Mutex held so Do_ADBG_UnwatchOp() can't return, and the operation go
+ * away, meanwhile.
+ */
+static void ADBG_Watchdog_Check(
+	ADBG_Watchdog_t *Watchdog_p
+	)
+{
+	uint64_t Now_us = ADBG_GetTime_us();
+	uint64_t Elapsed_us = Now_us - Watchdog_p->CaseStartTime_us;
+	size_t n;
+
+	if (Watchdog_p->TestID_p == NULL)
+		return;
+
+	if (Watchdog_p->TimedOut_us == 0) {
+		const char *Limit_p = NULL;
+		uint64_t Limit_us = 0;
+
+		if (Watchdog_p->CaseLimit_us != 0 &&
+		    Elapsed_us >= Watchdog_p->CaseLimit_us) {
+			Limit_p = "case";
+			Limit_us = Watchdog_p->CaseLimit_us;
+		}
+		for (n = 0; Limit_p == NULL && Watchdog_p->OpLimit_us != 0 &&
+			    n < ADBG_WATCHDOG_MAX_OPS; n++) {
+			if (Watchdog_p->Ops[n].Op_p != NULL &&
+			    Now_us - Watchdog_p->Ops[n].StartTime_us >=
+			    Watchdog_p->OpLimit_us) {
+				Limit_p = "operation";
+				Limit_us = Watchdog_p->OpLimit_us;
+			}
+		}
+		if (Limit_p == NULL)
+			return;
+
+		Do_ADBG_Log("%s: timed out after %.3f s, %s limit %.3f s",
+			    Watchdog_p->TestID_p, Elapsed_us / 1e6, Limit_p,
+			    Limit_us / 1e6);
+		Watchdog_p->TimedOut_us = Elapsed_us;
+		Watchdog_p->GiveUpTime_us = Now_us + ADBG_WATCHDOG_GRACE_US;
+	}
+
+	for (n = 0; n < ADBG_WATCHDOG_MAX_OPS; n++) {
+		ADBG_WatchedOp_t *WatchedOp_p = &Watchdog_p->Ops[n];
+
+		if (WatchedOp_p->Op_p == NULL || WatchedOp_p->Cancelled)
+			continue;
+		Do_ADBG_Log("%s: cancelling operation running for %.3f s",
+			    Watchdog_p->TestID_p,
+			    (Now_us - WatchedOp_p->StartTime_us) / 1e6);
+		Watchdog_p->Cancel_fp(WatchedOp_p->Op_p);
+		WatchedOp_p->Cancelled = true;
+	}
+
+	if (Now_us < Watchdog_p->GiveUpTime_us)
+		return;
+
+	/*
+	 * The case is stuck somewhere cancelling doesn't reach. A forked
+	 * job exits so the suite can carry on with the next case. Cases
+	 * only run in the suite process if fork() failed, then the run can
+	 * only end with the reports written so far.
+	 */
+	Do_ADBG_Log("%s: still running %.3f s after timing out, giving up",
+		    Watchdog_p->TestID_p, ADBG_WATCHDOG_GRACE_US / 1e6);
+	Do_ADBG_FlushLog();
+	if (getpid() != Watchdog_p->MainPid) {
+		fflush(stderr);
+		_exit(ADBG_WATCHDOG_EXIT);
+	}
+	exit(EXIT_FAILURE);
+}
+
+static void ADBG_Watchdog_Lock(void)
+{
+	pthread_mutex_lock(&ADBG_Watchdog.Mutex);
+}
+
+static void ADBG_Watchdog_Unlock(void)
+{
+	pthread_mutex_unlock(&ADBG_Watchdog.Mutex);
+}
@@ -13,7 +13,9 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
 #include <limits.h>
+#include <time.h>
 
 #ifdef USER_SPACE
 #include <pthread.h>
@@ -27,6 +29,7 @@
 #include <signed_hdr.h>
 
 #include <ta_crypt.h>
+#include <utee_defines.h>
 #include <ta_os_test.h>
 #include <ta_create_fail_test.h>
 #include <ta_rpc_test.h>
@@ -381,6 +384,330 @@ static void xtest_tee_test_1001(ADBG_Case_t *c)
 	TEEC_CloseSession(&session);
 }
 
+#define SHA2_STREAM_WINDOW	4096
+#define SHA2_STREAM_SIZE	(1024 * 1024 + 17)
+
+static void xtest_sha2_stream_split(ADBG_Case_t *c, TEEC_Session *session,
+				    TEEC_SharedMemory *shm)
+{
+	static const uint8_t sha224_out[] = {
+		0x23, 0x09, 0x7d, 0x22, 0x34, 0x05, 0xd8, 0x22,
+		0x86, 0x42, 0xa4, 0x77, 0xbd, 0xa2, 0x55, 0xb3,
+		0x2a, 0xad, 0xbc, 0xe4, 0xbd, 0xa0, 0xb3, 0xf7,
+		0xe3, 0x6c, 0x9d, 0xa7
+	};
+	static const uint8_t sha256_out[] = {
+		0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea,
+		0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+		0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c,
+		0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad
+	};
+	uint8_t out[32];
+	size_t dlen;
+	size_t n;
+
+	memcpy(shm->buffer, "abc", 3);
+
+	/* Update without init must be refused */
+	if (!ADBG_EXPECT_TEEC_RESULT(c, TEEC_ERROR_BAD_STATE,
+			ta_crypt_cmd_sha2_update(c, session, shm, 0, 3)))
+		return;
+
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		ta_crypt_cmd_sha2_init(c, session, TEE_ALG_SHA224)))
+		return;
+	for (n = 0; n < 3; n++) {
+		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+			ta_crypt_cmd_sha2_update(c, session, shm, n, 1)))
+			return;
+	}
+	dlen = sizeof(out);
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		ta_crypt_cmd_sha2_final(c, session, out, &dlen)))
+		return;
+	(void)ADBG_EXPECT_BUFFER(c, sha224_out, sizeof(sha224_out), out, dlen);
+
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		ta_crypt_cmd_sha2_init(c, session, TEE_ALG_SHA256)))
+		return;
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		ta_crypt_cmd_sha2_update(c, session, shm, 0, 0)))
+		return;
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		ta_crypt_cmd_sha2_update(c, session, shm, 0, 2)))
+		return;
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		ta_crypt_cmd_sha2_update(c, session, shm, 2, 1)))
+		return;
+	dlen = sizeof(out);
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		ta_crypt_cmd_sha2_final(c, session, out, &dlen)))
+		return;
+	(void)ADBG_EXPECT_BUFFER(c, sha256_out, sizeof(sha256_out), out, dlen);
+
+	/* The stream ends with final */
+	dlen = sizeof(out);
+	(void)ADBG_EXPECT_TEEC_RESULT(c, TEEC_ERROR_BAD_STATE,
+		ta_crypt_cmd_sha2_final(c, session, out, &dlen));
+}
+
+static void xtest_sha2_stream_large(ADBG_Case_t *c, TEEC_Session *session,
+				    TEEC_SharedMemory *shm)
+{
+	TEEC_Operation op = TEEC_OPERATION_INITIALIZER;
+	uint32_t ret_orig;
+	uint8_t ref[32] = { 0 };
+	uint8_t out[32] = { 0 };
+	uint8_t *data;
+	size_t dlen;
+	size_t n;
+
+	data = malloc(SHA2_STREAM_SIZE);
+	if (!ADBG_EXPECT_NOT_NULL(c, data))
+		return;
+	for (n = 0; n < SHA2_STREAM_SIZE; n++)
+		data[n] = n * 7 + (n >> 11);
+
+	/* Reference digest with a single invoke */
+	op.params[0].tmpref.buffer = data;
+	op.params[0].tmpref.size = SHA2_STREAM_SIZE;
+	op.params[1].tmpref.buffer = ref;
+	op.params[1].tmpref.size = sizeof(ref);
+	op.paramTypes = TEEC_PARAM_TYPES(TEEC_MEMREF_TEMP_INPUT,
+					 TEEC_MEMREF_TEMP_OUTPUT,
+					 TEEC_NONE, TEEC_NONE);
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		TEEC_InvokeCommand(session, TA_CRYPT_CMD_SHA256, &op,
+				   &ret_orig)))
+		goto out;
+
+	/* Same data fed through a fixed window of shared memory */
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		ta_crypt_cmd_sha2_init(c, session, TEE_ALG_SHA256)))
+		goto out;
+	for (n = 0; n < SHA2_STREAM_SIZE; n += SHA2_STREAM_WINDOW) {
+		size_t l = SHA2_STREAM_SIZE - n;
+
+		if (l > SHA2_STREAM_WINDOW)
+			l = SHA2_STREAM_WINDOW;
+		memcpy(shm->buffer, data + n, l);
+		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+			ta_crypt_cmd_sha2_update(c, session, shm, 0, l)))
+			goto out;
+	}
+	dlen = sizeof(out);
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		ta_crypt_cmd_sha2_final(c, session, out, &dlen)))
+		goto out;
+	(void)ADBG_EXPECT_BUFFER(c, ref, sizeof(ref), out, dlen);
+out:
+	free(data);
+}
+
+static void xtest_sha2_stream_test(ADBG_Case_t *c, TEEC_Session *session)
+{
+	TEEC_SharedMemory shm = { 0 };
+
+	shm.size = SHA2_STREAM_WINDOW;
+	shm.flags = TEEC_MEM_INPUT;
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		TEEC_AllocateSharedMemory(&xtest_teec_ctx, &shm)))
+		return;
+
+	Do_ADBG_BeginSubCase(c, "SHA-224/256 streaming, split input");
+	xtest_sha2_stream_split(c, session, &shm);
+	Do_ADBG_EndSubCase(c, "SHA-224/256 streaming, split input");
+
+	Do_ADBG_BeginSubCase(c, "SHA-256 streaming, large input");
+	xtest_sha2_stream_large(c, session, &shm);
+	Do_ADBG_EndSubCase(c, "SHA-256 streaming, large input");
+
+	TEEC_ReleaseSharedMemory(&shm);
+}
+
+/* impl NULL leaves params[2] out and uses the default block function */
+static TEEC_Result xtest_sha256_impl(TEEC_Session *session,
+				     const uint32_t *impl,
+				     const uint8_t *in, size_t in_len,
+				     uint8_t *out, size_t out_len)
+{
+	TEEC_Operation op = TEEC_OPERATION_INITIALIZER;
+	uint32_t ret_orig;
+
+	op.params[0].tmpref.buffer = (void *)in;
+	op.params[0].tmpref.size = in_len;
+	op.params[1].tmpref.buffer = out;
+	op.params[1].tmpref.size = out_len;
+	op.paramTypes = TEEC_PARAM_TYPES(TEEC_MEMREF_TEMP_INPUT,
+					 TEEC_MEMREF_TEMP_OUTPUT,
+					 TEEC_NONE, TEEC_NONE);
+	if (impl) {
+		op.params[2].value.a = *impl;
+		op.paramTypes = TEEC_PARAM_TYPES(TEEC_MEMREF_TEMP_INPUT,
+						 TEEC_MEMREF_TEMP_OUTPUT,
+						 TEEC_VALUE_INPUT, TEEC_NONE);
+	}
+
+	return TEEC_InvokeCommand(session, TA_CRYPT_CMD_SHA256, &op,
+				  &ret_orig);
+}
+
+/*
+ * Cross-checks each SHA-256 block function against the default one,
+ * with the lengths around the block and padding boundaries. On a TA
+ * built with the Crypto Extensions this keeps the generic code tested.
+ */
+static void xtest_sha256_impl_test(ADBG_Case_t *c, TEEC_Session *session)
+{
+	static const size_t lens[] = {
+		0, 3, 55, 56, 63, 64, 65, 119, 120, 128, 1000, 4097
+	};
+	uint8_t data[4097];
+	uint8_t ref[32];
+	uint8_t out[32];
+	uint32_t impl;
+	size_t n;
+
+	for (n = 0; n < sizeof(data); n++)
+		data[n] = n * 13 + 5;
+
+	Do_ADBG_BeginSubCase(c, "SHA-256 block functions");
+	for (impl = 0; impl < TA_CRYPT_SHA256_IMPL_COUNT; impl++) {
+		TEEC_Result res;
+
+		res = xtest_sha256_impl(session, &impl, data, 0, out,
+					sizeof(out));
+		if (res == TEEC_ERROR_NOT_SUPPORTED) {
+			Do_ADBG_Log("SHA-256 block function %u not available",
+				    (unsigned int)impl);
+			continue;
+		}
+		if (!ADBG_EXPECT_TEEC_SUCCESS(c, res))
+			break;
+
+		for (n = 0; n < sizeof(lens) / sizeof(lens[0]); n++) {
+			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+				xtest_sha256_impl(session, NULL, data, lens[n],
+						  ref, sizeof(ref))))
+				goto out;
+			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+				xtest_sha256_impl(session, &impl, data, lens[n],
+						  out, sizeof(out))))
+				goto out;
+			if (!ADBG_EXPECT_BUFFER(c, ref, sizeof(ref), out,
+						sizeof(out))) {
+				Do_ADBG_Log("block function %u, %zu bytes",
+					    (unsigned int)impl, lens[n]);
+				goto out;
+			}
+		}
+	}
+out:
+	Do_ADBG_EndSubCase(c, "SHA-256 block functions");
+}
+
+static TEEC_Result xtest_sha256_multi(TEEC_Session *session,
+				      const struct ta_crypt_sha256_msg *msgs,
+				      size_t num_msgs, const uint8_t *data,
+				      size_t data_len, uint8_t *digests)
+{
+	TEEC_Operation op = TEEC_OPERATION_INITIALIZER;
+	uint32_t ret_orig;
+
+	op.params[0].tmpref.buffer = (void *)msgs;
+	op.params[0].tmpref.size = num_msgs * sizeof(*msgs);
+	op.params[1].tmpref.buffer = (void *)data;
+	op.params[1].tmpref.size = data_len;
+	op.params[2].tmpref.buffer = digests;
+	op.params[2].tmpref.size = num_msgs * 32;
+	op.paramTypes = TEEC_PARAM_TYPES(TEEC_MEMREF_TEMP_INPUT,
+					 TEEC_MEMREF_TEMP_INPUT,
+					 TEEC_MEMREF_TEMP_OUTPUT, TEEC_NONE);
+
+	return TEEC_InvokeCommand(session, TA_CRYPT_CMD_SHA256_MULTI, &op,
+				  &ret_orig);
+}
+
+#define SHA256_MULTI_KAT_MAX_MSGS	24
+
+/*
+ * Batches for TA_CRYPT_CMD_SHA256_MULTI, each message length list is
+ * ended by a negative value. The lanes are refilled as messages finish,
+ * so a short message after a long one lands in a refilled lane.
+ */
+static const int sha256_multi_kat_lens[][SHA256_MULTI_KAT_MAX_MSGS + 1] = {
+	/* Single message, the other lanes stay idle */
+	{ 3, -1 },
+	/* Only empty messages */
+	{ 0, 0, 0, 0, 0, -1 },
+	/* Tails of 56-63 bytes, the padding takes an extra block */
+	{ 56, 57, 60, 63, 120, 127, 184, 191, -1 },
+	/* Tails of 0-55 bytes and block multiples */
+	{ 1, 55, 64, 65, 100, 128, 129, 200, -1 },
+	/* Mixed lengths, lanes finish at different times and get refilled */
+	{ 4000, 0, 1, 56, 63, 64, 2049, 3, 119, 120, 0, 1000, 55, 640, 9,
+	  65, 1500, 0, 57, 333, 62, 4097, 128, 7, -1 },
+};
+
+/*
+ * Known answer test of the multi-buffer SHA-256: every lane is compared
+ * with the digest of the same message from TA_CRYPT_CMD_SHA256.
+ */
+static void xtest_sha256_multi_test(ADBG_Case_t *c, TEEC_Session *session)
+{
+	struct ta_crypt_sha256_msg msgs[SHA256_MULTI_KAT_MAX_MSGS];
+	static uint8_t data[32 * 1024];
+	uint8_t digests[SHA256_MULTI_KAT_MAX_MSGS][32];
+	uint8_t ref[32];
+	size_t offs;
+	size_t num_msgs;
+	size_t b;
+	size_t n;
+
+	for (n = 0; n < sizeof(data); n++)
+		data[n] = n * 7 + (n >> 9);
+
+	Do_ADBG_BeginSubCase(c, "SHA-256 multi-buffer");
+
+	/* An empty batch gives no digests */
+	(void)ADBG_EXPECT_TEEC_SUCCESS(c,
+		xtest_sha256_multi(session, msgs, 0, data, sizeof(data),
+				   digests[0]));
+
+	for (b = 0; b < sizeof(sha256_multi_kat_lens) /
+			sizeof(sha256_multi_kat_lens[0]); b++) {
+		/* Odd offsets so the messages aren't aligned */
+		offs = 1;
+		for (num_msgs = 0; sha256_multi_kat_lens[b][num_msgs] >= 0;
+		     num_msgs++) {
+			msgs[num_msgs].offs = offs;
+			msgs[num_msgs].len = sha256_multi_kat_lens[b][num_msgs];
+			offs += msgs[num_msgs].len + 3;
+		}
+
+		memset(digests, 0, sizeof(digests));
+		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+			xtest_sha256_multi(session, msgs, num_msgs, data, offs,
+					   digests[0])))
+			break;
+
+		for (n = 0; n < num_msgs; n++) {
+			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+				xtest_sha256_impl(session, NULL,
+						  data + msgs[n].offs,
+						  msgs[n].len, ref,
+						  sizeof(ref))))
+				goto out;
+			if (!ADBG_EXPECT_BUFFER(c, ref, sizeof(ref),
+						digests[n], sizeof(ref)))
+				Do_ADBG_Log("batch %zu, message %zu, %u bytes",
+					    b, n, msgs[n].len);
+		}
+	}
+out:
+	Do_ADBG_EndSubCase(c, "SHA-256 multi-buffer");
+}
+
 static void xtest_tee_test_1004(ADBG_Case_t *c)
 {
 	TEEC_Session session = { 0 };
@@ -397,6 +724,12 @@ static void xtest_tee_test_1004(ADBG_Case_t *c)
 	/* Run the "complete crypto test suite" */
 	xtest_crypto_test(&cs);
 
+	xtest_sha2_stream_test(c, &session);
+
+	xtest_sha256_impl_test(c, &session);
+
+	xtest_sha256_multi_test(c, &session);
+
 	TEEC_CloseSession(&session);
 }
 
@@ -1014,28 +1347,33 @@ struct test_1013_thread_arg {
 	const TEEC_UUID *uuid;
 	uint32_t cmd;
 	uint32_t repeat;
+	size_t num_invokes;
 	TEEC_SharedMemory *shm;
 	uint32_t error_orig;
 	TEEC_Result res;
 	uint32_t max_concurrency;
+	uint64_t elapsed_us;
 	const uint8_t *in;
 	size_t in_len;
 	uint8_t *out;
 	size_t out_len;
 };
 
-static void *test_1013_thread(void *arg)
+static uint64_t test_1013_now_us(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static TEEC_Result test_1013_invoke(TEEC_Session *session,
+				    struct test_1013_thread_arg *a)
 {
-	struct test_1013_thread_arg *a = arg;
-	TEEC_Session session = { 0 };
 	TEEC_Operation op = TEEC_OPERATION_INITIALIZER;
 	uint8_t p2 = TEEC_NONE;
 	uint8_t p3 = TEEC_NONE;
-
-	a->res = xtest_teec_open_session(&session, a->uuid, NULL,
-					 &a->error_orig);
-	if (a->res != TEEC_SUCCESS)
-		return NULL;
+	TEEC_Result res;
 
 	op.params[0].memref.parent = a->shm;
 	op.params[0].memref.size = a->shm->size;
@@ -1055,24 +1393,70 @@ static void *test_1013_thread(void *arg)
 	op.paramTypes = TEEC_PARAM_TYPES(TEEC_MEMREF_PARTIAL_INOUT,
 					 TEEC_VALUE_INOUT, p2, p3);
 
-	a->res = TEEC_InvokeCommand(&session, a->cmd, &op, &a->error_orig);
-	a->max_concurrency = op.params[1].value.b;
+	res = TEEC_InvokeCommand(session, a->cmd, &op, &a->error_orig);
+	if (op.params[1].value.b > a->max_concurrency)
+		a->max_concurrency = op.params[1].value.b;
 	a->out_len = op.params[3].tmpref.size;
+	return res;
+}
+
+/*
+ * Opens one session and invokes a->cmd a->num_invokes times in it. The
+ * first invoke may allocate in the TA so only the following ones are
+ * timed, a->elapsed_us is 0 if there's just one.
+ */
+static void *test_1013_thread(void *arg)
+{
+	struct test_1013_thread_arg *a = arg;
+	TEEC_Session session = { 0 };
+	uint64_t t;
+	size_t n;
+
+	a->res = xtest_teec_open_session(&session, a->uuid, NULL,
+					 &a->error_orig);
+	if (a->res != TEEC_SUCCESS)
+		return NULL;
+
+	a->res = test_1013_invoke(&session, a);
+	t = test_1013_now_us();
+	for (n = 1; n < a->num_invokes && a->res == TEEC_SUCCESS; n++)
+		a->res = test_1013_invoke(&session, a);
+	a->elapsed_us = test_1013_now_us() - t;
+
 	TEEC_CloseSession(&session);
 	return NULL;
 }
 
 #define NUM_THREADS 3
 
-static void xtest_tee_test_1013_single(ADBG_Case_t *c, double *mean_concurrency,
-				       const TEEC_UUID *uuid)
+/*
+ * The SHA-256 invokes are run both with the digest operation pooled in
+ * the TA session and with it allocated by each invoke, to tell the
+ * allocation cost apart from the concurrency.
+ */
+#define NUM_SHA256_MODES 2
+
+/* Each thread does this many invokes of TEST_1013_SHA256_ROUNDS digests */
+#define TEST_1013_SHA256_INVOKES	100
+#define TEST_1013_SHA256_ROUNDS		10
+
+static const struct {
+	uint32_t flags;
+	const char *name;
+} test_1013_sha256_modes[NUM_SHA256_MODES] = {
+	{ 0, "pooled" },
+	{ TA_CONCURRENT_SHA256_FRESH_OP, "fresh" },
+};
+
+/* Adds the mean time of one timed invoke to *invoke_us */
+static size_t test_1013_sha256(ADBG_Case_t *c, const TEEC_UUID *uuid,
+			       TEEC_SharedMemory *shm, uint32_t flags,
+			       const char *name, double *invoke_us)
 {
 	size_t num_threads = NUM_THREADS;
 	size_t nt;
 	size_t n;
-	size_t repeat = 1000;
 	pthread_t thr[num_threads];
-	TEEC_SharedMemory shm;
 	size_t max_concurrency;
 	struct test_1013_thread_arg arg[num_threads];
 	static const uint8_t sha256_in[] = { 'a', 'b', 'c' };
@@ -1082,7 +1466,65 @@ static void xtest_tee_test_1013_single(ADBG_Case_t *c, double *mean_concurrency,
 		0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c,
 		0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad
 	};
-	uint8_t out[32] = { 0 };
+	uint8_t out[num_threads][32];
+	uint64_t elapsed_us = 0;
+	size_t num_timed = 0;
+
+	Do_ADBG_BeginSubCase(c, "SHA-256 %s, %d invokes", name,
+			     TEST_1013_SHA256_INVOKES);
+	memset(shm->buffer, 0, shm->size);
+	memset(arg, 0, sizeof(arg));
+	memset(out, 0, sizeof(out));
+	max_concurrency = 0;
+	nt = num_threads;
+
+	for (n = 0; n < nt; n++) {
+		arg[n].uuid = uuid;
+		arg[n].cmd = TA_CONCURRENT_CMD_SHA256;
+		arg[n].repeat = TEST_1013_SHA256_ROUNDS | flags;
+		arg[n].num_invokes = TEST_1013_SHA256_INVOKES;
+		arg[n].shm = shm;
+		arg[n].in = sha256_in;
+		arg[n].in_len = sizeof(sha256_in);
+		arg[n].out = out[n];
+		arg[n].out_len = sizeof(out[n]);
+		if (!ADBG_EXPECT(c, 0, pthread_create(thr + n, NULL,
+						test_1013_thread, arg + n)))
+			nt = n; /* break loop and start cleanup */
+	}
+
+	for (n = 0; n < nt; n++) {
+		if (ADBG_EXPECT(c, 0, pthread_join(thr[n], NULL)) &&
+		    ADBG_EXPECT_TEEC_SUCCESS(c, arg[n].res)) {
+			ADBG_EXPECT_BUFFER(c, sha256_out, sizeof(sha256_out),
+					   arg[n].out, arg[n].out_len);
+			elapsed_us += arg[n].elapsed_us;
+			num_timed += TEST_1013_SHA256_INVOKES - 1;
+		}
+		if (arg[n].max_concurrency > max_concurrency)
+			max_concurrency = arg[n].max_concurrency;
+	}
+	if (num_timed)
+		*invoke_us += (double)elapsed_us / num_timed;
+	Do_ADBG_EndSubCase(c, "SHA-256 %s, %d invokes", name,
+			   TEST_1013_SHA256_INVOKES);
+
+	return max_concurrency;
+}
+
+static void xtest_tee_test_1013_single(ADBG_Case_t *c, double *mean_concurrency,
+				       double *sha256_us,
+				       const TEEC_UUID *uuid)
+{
+	size_t num_threads = NUM_THREADS;
+	size_t nt;
+	size_t n;
+	size_t m;
+	size_t repeat = 1000;
+	pthread_t thr[num_threads];
+	TEEC_SharedMemory shm;
+	size_t max_concurrency;
+	struct test_1013_thread_arg arg[num_threads];
 
 	Do_ADBG_BeginSubCase(c, "Busy loop repeat %zu", repeat * 10);
 	*mean_concurrency = 0;
@@ -1103,6 +1545,7 @@ static void xtest_tee_test_1013_single(ADBG_Case_t *c, double *mean_concurrency,
 		arg[n].uuid = uuid;
 		arg[n].cmd = TA_CONCURRENT_CMD_BUSY_LOOP;
 		arg[n].repeat = repeat * 10;
+		arg[n].num_invokes = 1;
 		arg[n].shm = &shm;
 		if (!ADBG_EXPECT(c, 0, pthread_create(thr + n, NULL,
 						test_1013_thread, arg + n)))
@@ -1127,46 +1570,34 @@ static void xtest_tee_test_1013_single(ADBG_Case_t *c, double *mean_concurrency,
 	*mean_concurrency += max_concurrency;
 	Do_ADBG_EndSubCase(c, "Busy loop repeat %zu", repeat * 10);
 
-	Do_ADBG_BeginSubCase(c, "SHA-256 loop repeat %zu", repeat);
-	memset(shm.buffer, 0, shm.size);
-	memset(arg, 0, sizeof(arg));
-	max_concurrency = 0;
-	nt = num_threads;
-
-	for (n = 0; n < nt; n++) {
-		arg[n].uuid = uuid;
-		arg[n].cmd = TA_CONCURRENT_CMD_SHA256;
-		arg[n].repeat = repeat;
-		arg[n].shm = &shm;
-		arg[n].in = sha256_in;
-		arg[n].in_len = sizeof(sha256_in);
-		arg[n].out = out;
-		arg[n].out_len = sizeof(out);
-		if (!ADBG_EXPECT(c, 0, pthread_create(thr + n, NULL,
-						test_1013_thread, arg + n)))
-			nt = n; /* break loop and start cleanup */
+	for (m = 0; m < NUM_SHA256_MODES; m++) {
+		max_concurrency = test_1013_sha256(c, uuid, &shm,
+					test_1013_sha256_modes[m].flags,
+					test_1013_sha256_modes[m].name,
+					sha256_us + m);
+		*mean_concurrency += max_concurrency;
 	}
 
-	for (n = 0; n < nt; n++) {
-		if (ADBG_EXPECT(c, 0, pthread_join(thr[n], NULL)) &&
-		    ADBG_EXPECT_TEEC_SUCCESS(c, arg[n].res))
-			ADBG_EXPECT_BUFFER(c, sha256_out, sizeof(sha256_out),
-					   arg[n].out, arg[n].out_len);
-		if (arg[n].max_concurrency > max_concurrency)
-			max_concurrency = arg[n].max_concurrency;
-	}
-	*mean_concurrency += max_concurrency;
-	Do_ADBG_EndSubCase(c, "SHA-256 loop repeat %zu", repeat);
-
-	*mean_concurrency /= 2.0;
+	*mean_concurrency /= 1 + NUM_SHA256_MODES;
 	TEEC_ReleaseSharedMemory(&shm);
 }
 
+static void test_1013_log_sha256(double *sha256_us, int nb_loops)
+{
+	size_t m;
+
+	for (m = 0; m < NUM_SHA256_MODES; m++)
+		Do_ADBG_Log("    Mean SHA-256 %s invoke time: %g us",
+			    test_1013_sha256_modes[m].name,
+			    sha256_us[m] / nb_loops);
+}
+
 static void xtest_tee_test_1013(ADBG_Case_t *c)
 {
 	int i;
 	double mean_concurrency;
 	double concurrency;
+	double sha256_us[NUM_SHA256_MODES];
 	int nb_loops = 24;
 
 	if (level == 0)
@@ -1174,8 +1605,9 @@ static void xtest_tee_test_1013(ADBG_Case_t *c)
 
 	Do_ADBG_BeginSubCase(c, "Using small concurrency TA");
 	mean_concurrency = 0;
+	memset(sha256_us, 0, sizeof(sha256_us));
 	for (i = 0; i < nb_loops; i++) {
-		xtest_tee_test_1013_single(c, &concurrency,
+		xtest_tee_test_1013_single(c, &concurrency, sha256_us,
 					   &concurrent_ta_uuid);
 		mean_concurrency += concurrency;
 	}
@@ -1183,12 +1615,14 @@ static void xtest_tee_test_1013(ADBG_Case_t *c)
 
 	Do_ADBG_Log("    Number of parallel threads: %d", NUM_THREADS);
 	Do_ADBG_Log("    Mean concurrency: %g", mean_concurrency);
+	test_1013_log_sha256(sha256_us, nb_loops);
 	Do_ADBG_EndSubCase(c, "Using small concurrency TA");
 
 	Do_ADBG_BeginSubCase(c, "Using large concurrency TA");
 	mean_concurrency = 0;
+	memset(sha256_us, 0, sizeof(sha256_us));
 	for (i = 0; i < nb_loops; i++) {
-		xtest_tee_test_1013_single(c, &concurrency,
+		xtest_tee_test_1013_single(c, &concurrency, sha256_us,
 					   &concurrent_large_ta_uuid);
 		mean_concurrency += concurrency;
 	}
@@ -1196,5 +1630,6 @@ static void xtest_tee_test_1013(ADBG_Case_t *c)
 
 	Do_ADBG_Log("    Number of parallel threads: %d", NUM_THREADS);
 	Do_ADBG_Log("    Mean concurrency: %g", mean_concurrency);
+	test_1013_log_sha256(sha256_us, nb_loops);
 	Do_ADBG_EndSubCase(c, "Using large concurrency TA");
 }
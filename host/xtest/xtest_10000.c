@@ -744,8 +744,8 @@ static void xtest_tee_test_10001(ADBG_Case_t *c)
 	uint32_t ret_orig;
 
 	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-		xtest_teec_open_session(&session, &crypt_user_ta_uuid, NULL,
-					&ret_orig)))
+		xtest_teec_lease_session(c, &session, &crypt_user_ta_uuid,
+					 &ret_orig)))
 		return;
 
 #ifdef WITH_HKDF
@@ -758,7 +758,7 @@ static void xtest_tee_test_10001(ADBG_Case_t *c)
 	xtest_test_derivation_pbkdf2(c, &session);
 #endif
 
-	TEEC_CloseSession(&session);
+	xtest_teec_release_session(c, &session);
 }
 
 /* secure storage key manager self test */
@@ -18,6 +18,8 @@
 
 #include "xtest_test.h"
 #include "xtest_helpers.h"
+#include "xtest_rsp.h"
+#include "xtest_vectors.h"
 
 #include <tee_api_types.h>
 #include <ta_crypt.h>
@@ -25,7 +27,6 @@
 #include <util.h>
 
 #include <xtest_4000_data.h>
-#include <nist/186-2ecdsatestvectors.h>
 
 #include <assert.h>
 
@@ -1714,8 +1715,8 @@ static void xtest_tee_test_4002(ADBG_Case_t *c)
 	size_t n;
 
 	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-		xtest_teec_open_session(&session, &crypt_user_ta_uuid, NULL,
-					&ret_orig)))
+		xtest_teec_lease_session(c, &session, &crypt_user_ta_uuid,
+					 &ret_orig)))
 		return;
 
 	for (n = 0; n < ARRAY_SIZE(mac_cases); n++) {
@@ -1818,7 +1819,7 @@ static void xtest_tee_test_4002(ADBG_Case_t *c)
 		Do_ADBG_EndSubCase(c, NULL);
 	}
 out:
-	TEEC_CloseSession(&session);
+	xtest_teec_release_session(c, &session);
 }
 
 /* generated with scripts/crypt_aes_cbc_nopad.pl */
@@ -2326,8 +2327,8 @@ static void xtest_tee_test_4003_no_xts(ADBG_Case_t *c)
 	size_t n;
 
 	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-		xtest_teec_open_session(&session, &crypt_user_ta_uuid, NULL,
-					&ret_orig)))
+		xtest_teec_lease_session(c, &session, &crypt_user_ta_uuid,
+					 &ret_orig)))
 		return;
 
 	for (n = 0; n < ARRAY_SIZE(ciph_cases); n++) {
@@ -2448,7 +2449,7 @@ static void xtest_tee_test_4003_no_xts(ADBG_Case_t *c)
 		Do_ADBG_EndSubCase(c, NULL);
 	}
 out:
-	TEEC_CloseSession(&session);
+	xtest_teec_release_session(c, &session);
 }
 
 /*
@@ -2469,8 +2470,8 @@ static void xtest_tee_test_4003_xts(ADBG_Case_t *c)
 	size_t n;
 
 	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-		xtest_teec_open_session(&session, &crypt_user_ta_uuid, NULL,
-					&ret_orig)))
+		xtest_teec_lease_session(c, &session, &crypt_user_ta_uuid,
+					 &ret_orig)))
 		return;
 
 	for (n = 0; n < ARRAY_SIZE(ciph_cases_xts); n++) {
@@ -2600,7 +2601,7 @@ static void xtest_tee_test_4003_xts(ADBG_Case_t *c)
 		Do_ADBG_EndSubCase(c, NULL);
 	}
 out:
-	TEEC_CloseSession(&session);
+	xtest_teec_release_session(c, &session);
 }
 
 static void xtest_tee_test_4004(ADBG_Case_t *c)
@@ -2613,8 +2614,8 @@ static void xtest_tee_test_4004(ADBG_Case_t *c)
 
 	Do_ADBG_BeginSubCase(c, "TEE get random");
 	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-		xtest_teec_open_session(&session, &crypt_user_ta_uuid, NULL,
-			&ret_orig)))
+		xtest_teec_lease_session(c, &session, &crypt_user_ta_uuid,
+					 &ret_orig)))
 		return;
 
 	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
@@ -2636,7 +2637,7 @@ static void xtest_tee_test_4004(ADBG_Case_t *c)
 	(void)ADBG_EXPECT_COMPARE_SIGNED(c,
 		0, !=, memcmp(buf2, buf1, sizeof(buf1)));
 out:
-	TEEC_CloseSession(&session);
+	xtest_teec_release_session(c, &session);
 	Do_ADBG_EndSubCase(c, "TEE get random");
 }
 
@@ -2718,6 +2719,153 @@ static const struct xtest_ae_case ae_cases[] = {
 	XTEST_AE_CASE_AES_GCM(vect18, 5, 9, ARRAY, ARRAY, ARRAY),
 };
 
+/*
+ * Same as one round in xtest_tee_test_4005() below but with all the
+ * commands in a single TA_CRYPT_CMD_BATCH invocation.
+ */
+static void xtest_ae_case_batch(ADBG_Case_t *c, TEEC_Session *s,
+				const struct xtest_ae_case *ae)
+{
+	uint32_t vin = TEEC_VALUE_INPUT;
+	uint32_t min = TEEC_MEMREF_TEMP_INPUT;
+	uint32_t mout = TEEC_MEMREF_TEMP_OUTPUT;
+	struct xtest_batch b;
+	TEE_Attribute key_attr;
+	const uint8_t *in = ae->mode == TEE_MODE_ENCRYPT ? ae->ptx : ae->ctx;
+	size_t in_len = ae->mode == TEE_MODE_ENCRYPT ? ae->ptx_len :
+						       ae->ctx_len;
+	uint8_t out[512] = { 0 };
+	uint8_t final_out[512] = { 0 };
+	uint8_t out_tag[64] = { 0 };
+	size_t out_size = sizeof(out);
+	size_t final_size = sizeof(final_out);
+	size_t out_tag_len = MIN(sizeof(out_tag), ae->tag_len);
+	size_t in_incr = in ? ae->in_incr : 0;
+	size_t op_idx;
+	size_t obj_idx;
+	size_t n;
+
+	key_attr.attributeID = TEE_ATTR_SECRET_VALUE;
+	key_attr.content.ref.buffer = (void *)ae->key;
+	key_attr.content.ref.length = ae->key_len;
+
+	xtest_batch_init(&b);
+
+	op_idx = xtest_batch_add(&b, TA_CRYPT_CMD_ALLOCATE_OPERATION,
+			TEEC_PARAM_TYPES(TEEC_VALUE_INOUT, vin, TEEC_NONE,
+					 TEEC_NONE));
+	xtest_batch_value(&b, op_idx, 0, 0, ae->algo);
+	xtest_batch_value(&b, op_idx, 1, ae->mode, ae->key_len * 8);
+
+	obj_idx = xtest_batch_add(&b, TA_CRYPT_CMD_ALLOCATE_TRANSIENT_OBJECT,
+			TEEC_PARAM_TYPES(vin, TEEC_VALUE_OUTPUT, TEEC_NONE,
+					 TEEC_NONE));
+	xtest_batch_value(&b, obj_idx, 0, ae->key_type, ae->key_len * 8);
+
+	n = xtest_batch_add(&b, TA_CRYPT_CMD_POPULATE_TRANSIENT_OBJECT,
+			TEEC_PARAM_TYPES(vin, min, TEEC_NONE, TEEC_NONE));
+	xtest_batch_ref(&b, n, 0, 0, obj_idx, 1, 0);
+	xtest_batch_attrs(&b, n, 1, &key_attr, 1);
+
+	n = xtest_batch_add(&b, TA_CRYPT_CMD_SET_OPERATION_KEY,
+			TEEC_PARAM_TYPES(vin, TEEC_NONE, TEEC_NONE, TEEC_NONE));
+	xtest_batch_ref(&b, n, 0, 0, op_idx, 0, 0);
+	xtest_batch_ref(&b, n, 0, 1, obj_idx, 1, 0);
+
+	n = xtest_batch_add(&b, TA_CRYPT_CMD_FREE_TRANSIENT_OBJECT,
+			TEEC_PARAM_TYPES(vin, TEEC_NONE, TEEC_NONE, TEEC_NONE));
+	xtest_batch_ref(&b, n, 0, 0, obj_idx, 1, 0);
+
+	n = xtest_batch_add(&b, TA_CRYPT_CMD_AE_INIT,
+			TEEC_PARAM_TYPES(vin, min, vin, TEEC_NONE));
+	xtest_batch_ref(&b, n, 0, 0, op_idx, 0, 0);
+	xtest_batch_value(&b, n, 0, 0, ae->tag_len);
+	xtest_batch_memref_in(&b, n, 1, ae->nonce, ae->nonce_len);
+	xtest_batch_value(&b, n, 2, ae->aad_len, ae->ptx_len);
+
+	if (ae->aad) {
+		n = xtest_batch_add(&b, TA_CRYPT_CMD_AE_UPDATE_AAD,
+				TEEC_PARAM_TYPES(vin, min, TEEC_NONE,
+						 TEEC_NONE));
+		xtest_batch_ref(&b, n, 0, 0, op_idx, 0, 0);
+		xtest_batch_memref_in(&b, n, 1, ae->aad, ae->aad_incr);
+
+		n = xtest_batch_add(&b, TA_CRYPT_CMD_AE_UPDATE_AAD,
+				TEEC_PARAM_TYPES(vin, min, TEEC_NONE,
+						 TEEC_NONE));
+		xtest_batch_ref(&b, n, 0, 0, op_idx, 0, 0);
+		xtest_batch_memref_in(&b, n, 1, ae->aad + ae->aad_incr,
+				      ae->aad_len - ae->aad_incr);
+	}
+
+	if (in) {
+		n = xtest_batch_add(&b, TA_CRYPT_CMD_AE_UPDATE,
+				TEEC_PARAM_TYPES(vin, min, mout, TEEC_NONE));
+		xtest_batch_ref(&b, n, 0, 0, op_idx, 0, 0);
+		xtest_batch_memref_in(&b, n, 1, in, in_incr);
+		xtest_batch_memref_out(&b, n, 2, out, &out_size);
+	} else {
+		out_size = 0;
+	}
+
+	if (ae->mode == TEE_MODE_ENCRYPT) {
+		n = xtest_batch_add(&b, TA_CRYPT_CMD_AE_ENCRYPT_FINAL,
+				TEEC_PARAM_TYPES(vin, min, mout, mout));
+		xtest_batch_memref_out(&b, n, 3, out_tag, &out_tag_len);
+	} else {
+		n = xtest_batch_add(&b, TA_CRYPT_CMD_AE_DECRYPT_FINAL,
+				TEEC_PARAM_TYPES(vin, min, mout, min));
+		xtest_batch_memref_in(&b, n, 3, ae->tag, ae->tag_len);
+	}
+	xtest_batch_ref(&b, n, 0, 0, op_idx, 0, 0);
+	xtest_batch_memref_in(&b, n, 1, in ? in + in_incr : NULL,
+			      in_len - in_incr);
+	xtest_batch_memref_out(&b, n, 2, final_out, &final_size);
+
+	n = xtest_batch_add(&b, TA_CRYPT_CMD_FREE_OPERATION,
+			TEEC_PARAM_TYPES(vin, TEEC_NONE, TEEC_NONE, TEEC_NONE));
+	xtest_batch_ref(&b, n, 0, 0, op_idx, 0, 0);
+
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c, xtest_batch_invoke(c, s, &b)))
+		goto out;
+
+	if (!ADBG_EXPECT_COMPARE_UNSIGNED(c, out_size + final_size, <=,
+					  sizeof(out)))
+		goto out;
+	memcpy(out + out_size, final_out, final_size);
+
+	if (ae->mode == TEE_MODE_ENCRYPT) {
+		(void)ADBG_EXPECT_BUFFER(c, ae->tag, ae->tag_len, out_tag,
+					 out_tag_len);
+		(void)ADBG_EXPECT_BUFFER(c, ae->ctx, ae->ctx_len, out,
+					 out_size + final_size);
+	} else {
+		(void)ADBG_EXPECT_BUFFER(c, ae->ptx, ae->ptx_len, out,
+					 out_size + final_size);
+	}
+out:
+	xtest_batch_free(&b);
+}
+
+/*
+ * The batch only changes how the commands reach the TA, so at level 0
+ * it's run for the first encrypt and decrypt case of each algorithm.
+ * Higher levels run it for all cases.
+ */
+static bool xtest_ae_case_batched(size_t n)
+{
+	size_t m;
+
+	if (level > 0)
+		return true;
+	for (m = 0; m < n; m++) {
+		if (ae_cases[m].algo == ae_cases[n].algo &&
+		    ae_cases[m].mode == ae_cases[n].mode)
+			return false;
+	}
+	return true;
+}
+
 static void xtest_tee_test_4005(ADBG_Case_t *c)
 {
 	TEEC_Session session = { 0 };
@@ -2731,8 +2879,8 @@ static void xtest_tee_test_4005(ADBG_Case_t *c)
 	size_t n;
 
 	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-		xtest_teec_open_session(&session, &crypt_user_ta_uuid, NULL,
-			&ret_orig)))
+		xtest_teec_lease_session(c, &session, &crypt_user_ta_uuid,
+					 &ret_orig)))
 		return;
 
 	for (n = 0; n < ARRAY_SIZE(ae_cases); n++) {
@@ -2862,10 +3010,13 @@ static void xtest_tee_test_4005(ADBG_Case_t *c)
 			ta_crypt_cmd_free_operation(c, &session, op)))
 			goto out;
 
+		if (xtest_ae_case_batched(n))
+			xtest_ae_case_batch(c, &session, ae_cases + n);
+
 		Do_ADBG_EndSubCase(c, NULL);
 	}
 out:
-	TEEC_CloseSession(&session);
+	xtest_teec_release_session(c, &session);
 }
 
 struct xtest_ac_case {
@@ -2952,28 +3103,6 @@ struct xtest_ac_case {
 	XTEST_AC_CASE(level, algo, mode, vect, \
 		      XTEST_AC_RSA_UNION(vect, opt_crt_array, opt_salt))
 
-#define XTEST_AC_DSA_UNION(vect) \
-	{ .dsa = { \
-		  ARRAY(vect ## _prime), \
-		  ARRAY(vect ## _sub_prime), \
-		  ARRAY(vect ## _base), \
-		  ARRAY(vect ## _pub_val), \
-		  ARRAY(vect ## _priv_val), \
-	  } }
-
-#define XTEST_AC_DSA_CASE(level, algo, mode, vect) \
-	XTEST_AC_CASE(level, algo, mode, vect, XTEST_AC_DSA_UNION(vect))
-
-#define XTEST_AC_ECDSA_UNION(vect) \
-	{ .ecdsa = { \
-		  ARRAY(vect ## _private), \
-		  ARRAY(vect ## _public_x), \
-		  ARRAY(vect ## _public_y), \
-	  } }
-
-#define XTEST_AC_ECDSA_CASE(level, algo, mode, vect) \
-	XTEST_AC_CASE(level, algo, mode, vect, XTEST_AC_ECDSA_UNION(vect))
-
 static const struct xtest_ac_case xtest_ac_cases[] = {
 	/* RSA test without crt parameters */
 	XTEST_AC_RSA_CASE(0, TEE_ALG_RSA_NOPAD, TEE_MODE_ENCRYPT,
@@ -3202,532 +3331,243 @@ static const struct xtest_ac_case xtest_ac_cases[] = {
 	XTEST_AC_RSA_CASE(1, TEE_ALG_RSAES_PKCS1_OAEP_MGF1_SHA1,
 			  TEE_MODE_ENCRYPT,
 			  ac_rsaes_oaep_vect10, ARRAY, WITHOUT_SALT),
+};
+
+/*
+ * The DSA and ECDSA cases are loaded from the NIST SigGen files when the
+ * test runs, each vector gives a verify and a sign case. Sections which
+ * aren't listed below aren't supported by GP and are skipped.
+ */
+#define DSA_RSP_FILE		"186-3dsa_SigGen.rsp"
+#define ECDSA_RSP_FILE		"186-2ecdsa_SigGen.rsp"
+
+struct ac_rsp_sect {
+	const char *name;	/* section in the .rsp file */
+	uint32_t algo;
+	unsigned int level;	/* of the first vector, the others are 15 */
+};
+
+static const struct ac_rsp_sect ac_dsa_sects[] = {
+	{ "mod = L=1024, N=160, SHA-1", TEE_ALG_DSA_SHA1, 1 },
+	{ "mod = L=2048, N=224, SHA-224", TEE_ALG_DSA_SHA224, 1 },
+	{ "mod = L=2048, N=224, SHA-256", TEE_ALG_DSA_SHA256, 0 },
+	{ "mod = L=2048, N=256, SHA-224", TEE_ALG_DSA_SHA224, 1 },
+	{ "mod = L=2048, N=256, SHA-256", TEE_ALG_DSA_SHA256, 1 },
+	{ "mod = L=3072, N=256, SHA-256", TEE_ALG_DSA_SHA256, 1 },
+};
+
+static const struct ac_rsp_sect ac_ecdsa_sects[] = {
+	{ "P-192", TEE_ALG_ECDSA_P192, 0 },
+	{ "P-224", TEE_ALG_ECDSA_P224, 1 },
+	{ "P-256", TEE_ALG_ECDSA_P256, 1 },
+	{ "P-384", TEE_ALG_ECDSA_P384, 1 },
+	{ "P-521", TEE_ALG_ECDSA_P521, 1 },
+};
+
+struct ac_rsp_file {
+	const char *name;
+	const struct ac_rsp_sect *sects;
+	size_t num_sects;
+};
+
+static const struct ac_rsp_file ac_rsp_files[] = {
+	{ DSA_RSP_FILE, ac_dsa_sects, ARRAY_SIZE(ac_dsa_sects) },
+	{ ECDSA_RSP_FILE, ac_ecdsa_sects, ARRAY_SIZE(ac_ecdsa_sects) },
+};
+
+/*
+ * Opening the files only indexes the cases, each is decoded into the
+ * buffer of the worker running it. The largest vector, DSA with L=3072,
+ * takes about 1.5 kB.
+ */
+#define AC_RSP_BUF_SIZE		4096
+
+struct ac_rsp_buf {
+	uint8_t data[AC_RSP_BUF_SIZE];
+	size_t used;
+};
 
-	/* DSA tests */
-	/* [mod = L=1024, N=160, SHA-1] */
-	XTEST_AC_DSA_CASE(1, TEE_ALG_DSA_SHA1, TEE_MODE_VERIFY, ac_dsa_vect1),
-	XTEST_AC_DSA_CASE(1, TEE_ALG_DSA_SHA1, TEE_MODE_SIGN, ac_dsa_vect1),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_VERIFY, ac_dsa_vect2),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_SIGN, ac_dsa_vect2),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_VERIFY, ac_dsa_vect3),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_SIGN, ac_dsa_vect3),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_VERIFY, ac_dsa_vect4),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_SIGN, ac_dsa_vect4),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_VERIFY, ac_dsa_vect5),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_SIGN, ac_dsa_vect5),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_VERIFY, ac_dsa_vect6),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_SIGN, ac_dsa_vect6),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_VERIFY, ac_dsa_vect7),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_SIGN, ac_dsa_vect7),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_VERIFY, ac_dsa_vect8),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_SIGN, ac_dsa_vect8),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_VERIFY, ac_dsa_vect9),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_SIGN, ac_dsa_vect9),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_VERIFY, ac_dsa_vect10),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_SIGN, ac_dsa_vect10),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_VERIFY, ac_dsa_vect11),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_SIGN, ac_dsa_vect11),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_VERIFY, ac_dsa_vect12),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_SIGN, ac_dsa_vect12),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_VERIFY, ac_dsa_vect13),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_SIGN, ac_dsa_vect13),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_VERIFY, ac_dsa_vect14),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_SIGN, ac_dsa_vect14),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_VERIFY, ac_dsa_vect15),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA1, TEE_MODE_SIGN, ac_dsa_vect15),
-	/* [mod = L=1024, N=160, SHA-224] - GP NOT SUPPORTED */
-	/* [mod = L=1024, N=160, SHA-256] - GP NOT SUPPORTED */
-	/* [mod = L=1024, N=160, SHA-384] - GP NOT SUPPORTED */
-	/* [mod = L=1024, N=160, SHA-512] - GP NOT SUPPORTED */
-	/* [mod = L=2048, N=224, SHA-1] - GP NOT SUPPORTED */
-	/* [mod = L=2048, N=224, SHA-224] */
-	XTEST_AC_DSA_CASE(1, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect91),
-	XTEST_AC_DSA_CASE(1, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect91),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect92),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect92),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect93),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect93),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect94),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect94),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect95),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect95),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect96),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect96),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect97),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect97),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect98),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect98),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect99),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect99),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect100),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect100),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect101),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect101),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect102),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect102),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect103),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect103),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect104),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect104),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect105),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect105),
-	/* [mod = L=2048, N=224, SHA-256] */
-	XTEST_AC_DSA_CASE(0, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect106),
-	XTEST_AC_DSA_CASE(0, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect106),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect107),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect107),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect108),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect108),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect109),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect109),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect110),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect110),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect111),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect111),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect112),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect112),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect113),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect113),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect114),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect114),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect115),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect115),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect116),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect116),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect117),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect117),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect118),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect118),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect119),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect119),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect120),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect120),
-	/* [mod = L=2048, N=224, SHA-384] - GP NOT SUPPORTED */
-	/* [mod = L=2048, N=224, SHA-512] - GP NOT SUPPORTED */
-	/* [mod = L=2048, N=256, SHA-1] - GP NOT SUPPORTED */
-	/* [mod = L=2048, N=256, SHA-224] */
-	XTEST_AC_DSA_CASE(1, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect166),
-	XTEST_AC_DSA_CASE(1, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect166),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect167),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect167),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect168),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect168),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect169),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect169),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect170),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect170),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect171),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect171),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect172),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect172),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect173),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect173),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect174),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect174),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect175),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect175),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect176),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect176),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect177),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect177),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect178),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect178),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect179),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect179),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_VERIFY, ac_dsa_vect180),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA224, TEE_MODE_SIGN, ac_dsa_vect180),
-	/* [mod = L=2048, N=256, SHA-256] */
-	XTEST_AC_DSA_CASE(1, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect181),
-	XTEST_AC_DSA_CASE(1, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect181),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect182),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect182),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect183),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect183),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect184),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect184),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect185),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect185),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect186),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect186),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect187),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect187),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect188),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect188),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect189),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect189),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect190),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect190),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect191),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect191),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect192),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect192),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect193),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect193),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect194),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect194),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect195),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect195),
-	/* [mod = L=2048, N=256, SHA-384] - GP NOT SUPPORTED */
-	/* [mod = L=2048, N=256, SHA-512] - GP NOT SUPPORTED */
-	/* [mod = L=3072, N=256, SHA-1] - GP NOT SUPPORTED */
-	/* [mod = L=3072, N=256, SHA-224] - GP NOT SUPPORTED */
-	/* [mod = L=3072, N=256, SHA-256] */
-	XTEST_AC_DSA_CASE(1, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect256),
-	XTEST_AC_DSA_CASE(1, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect256),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect257),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect257),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect258),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect258),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect259),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect259),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect260),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect260),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect261),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect261),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect262),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect262),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect263),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect263),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect264),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect264),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect265),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect265),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect266),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect266),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect267),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect267),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect268),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect268),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect269),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect269),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_VERIFY, ac_dsa_vect270),
-	XTEST_AC_DSA_CASE(15, TEE_ALG_DSA_SHA256, TEE_MODE_SIGN, ac_dsa_vect270),
-	/* [mod = L=3072, N=256, SHA-384] - GP NOT SUPPORTED */
-	/* [mod = L=3072, N=256, SHA-512] - GP NOT SUPPORTED */
-
-	/* ECDSA tests */
-	/* [P-192] */
-	XTEST_AC_ECDSA_CASE(0, TEE_ALG_ECDSA_P192, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_1),
-	XTEST_AC_ECDSA_CASE(0, TEE_ALG_ECDSA_P192, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_1),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_2),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_2),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_3),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_3),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_4),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_4),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_5),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_5),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_6),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_6),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_7),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_7),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_8),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_8),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_9),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_9),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_10),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_10),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_11),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_11),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_12),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_12),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_13),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_13),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_14),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_14),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_15),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P192, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_15),
-	/* [P-224] */
-	XTEST_AC_ECDSA_CASE(1, TEE_ALG_ECDSA_P224, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_16),
-	XTEST_AC_ECDSA_CASE(1, TEE_ALG_ECDSA_P224, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_16),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_17),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_17),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_18),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_18),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_19),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_19),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_20),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_20),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_21),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_21),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_22),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_22),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_23),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_23),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_24),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_24),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_25),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_25),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_26),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_26),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_27),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_27),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_28),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_28),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_29),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_29),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_30),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P224, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_30),
-	/* [P-256] */
-	XTEST_AC_ECDSA_CASE(1, TEE_ALG_ECDSA_P256, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_31),
-	XTEST_AC_ECDSA_CASE(1, TEE_ALG_ECDSA_P256, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_31),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_32),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_32),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_33),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_33),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_34),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_34),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_35),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_35),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_36),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_36),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_37),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_37),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_38),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_38),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_39),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_39),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_40),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_40),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_41),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_41),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_42),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_42),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_43),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_43),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_44),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_44),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_45),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P256, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_45),
-	/* [P-384] */
-	XTEST_AC_ECDSA_CASE(1, TEE_ALG_ECDSA_P384, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_46),
-	XTEST_AC_ECDSA_CASE(1, TEE_ALG_ECDSA_P384, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_46),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_47),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_47),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_48),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_48),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_49),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_49),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_50),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_50),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_51),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_51),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_52),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_52),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_53),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_53),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_54),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_54),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_55),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_55),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_56),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_56),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_57),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_57),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_58),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_58),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_59),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_59),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_60),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P384, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_60),
-	/* [P-521] */
-	XTEST_AC_ECDSA_CASE(1, TEE_ALG_ECDSA_P521, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_61),
-	XTEST_AC_ECDSA_CASE(1, TEE_ALG_ECDSA_P521, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_61),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_62),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_62),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_63),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_63),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_64),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_64),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_65),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_65),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_66),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_66),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_67),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_67),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_68),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_68),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_69),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_69),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_70),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_70),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_71),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_71),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_72),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_72),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_73),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_73),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_74),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_74),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_VERIFY,
-			    nist_186_2_ecdsa_testvector_75),
-	XTEST_AC_ECDSA_CASE(15, TEE_ALG_ECDSA_P521, TEE_MODE_SIGN,
-			    nist_186_2_ecdsa_testvector_75),
-	/* [K-163] - GP NOT SUPPORTED */
-	/* [K-233] - GP NOT SUPPORTED */
-	/* [K-283] - GP NOT SUPPORTED */
-	/* [K-409] - GP NOT SUPPORTED */
-	/* [K-571] - GP NOT SUPPORTED */
-	/* [B-163] - GP NOT SUPPORTED */
-	/* [B-233] - GP NOT SUPPORTED */
-	/* [B-283] - GP NOT SUPPORTED */
-	/* [B-409] - GP NOT SUPPORTED */
-	/* [B-571] - GP NOT SUPPORTED */
+struct ac_rsp_case {
+	const struct xtest_rsp *rsp;
+	const char *file;
+	size_t vect;
+	size_t domain;		/* DSA vector with P, Q and G */
+	uint32_t algo;
+	TEE_OperationMode mode;
+	unsigned int level;
+	size_t line;
 };
 
+static struct xtest_rsp ac_rsps[ARRAY_SIZE(ac_rsp_files)];
+/* Numbered after xtest_ac_cases, only valid while 4006 runs */
+static struct ac_rsp_case *ac_rsp_cases;
+static size_t ac_rsp_num_cases;
+
+static const struct ac_rsp_sect *ac_rsp_find_sect(const struct ac_rsp_file *f,
+						  const struct xtest_rsp *rsp,
+						  size_t n)
+{
+	size_t i;
+
+	for (i = 0; i < f->num_sects; i++)
+		if (xtest_rsp_in_section(rsp, n, f->sects[i].name))
+			return f->sects + i;
+	return NULL;
+}
+
+static bool ac_rsp_load(ADBG_Case_t *c, const struct ac_rsp_file *f,
+			struct xtest_rsp *rsp)
+{
+	const struct ac_rsp_sect *sect;
+	struct ac_rsp_case *cases;
+	struct ac_rsp_case rc;
+	size_t line = 1;
+	size_t pos = 0;
+	bool first = false;
+	bool have_domain = false;
+	size_t n;
+
+	if (!xtest_rsp_available(f->name)) {
+		Do_ADBG_Log("%s/%s not installed, skipping its vectors",
+			    xtest_vector_dir, f->name);
+		return true;
+	}
+
+	if (!ADBG_EXPECT_TRUE(c, xtest_rsp_open(rsp, f->name)))
+		return false;
+
+	cases = realloc(ac_rsp_cases, (ac_rsp_num_cases + 2 * rsp->num_vects) *
+				      sizeof(*cases));
+	if (!ADBG_EXPECT_NOT_NULL(c, cases))
+		return false;
+	ac_rsp_cases = cases;
+
+	memset(&rc, 0, sizeof(rc));
+	rc.rsp = rsp;
+	rc.file = f->name;
+	for (n = 0; n < rsp->num_vects; n++) {
+		if (!n || rsp->vects[n].sect != rsp->vects[n - 1].sect) {
+			first = true;
+			have_domain = false;
+		}
+		sect = ac_rsp_find_sect(f, rsp, n);
+		if (!sect)
+			continue;
+
+		/* The domain of a DSA section comes before its vectors */
+		if (TEE_ALG_GET_MAIN_ALG(sect->algo) == TEE_MAIN_ALGO_DSA) {
+			if (xtest_rsp_has_key(rsp, n, "P")) {
+				rc.domain = n;
+				have_domain = true;
+				continue;
+			}
+			if (!ADBG_EXPECT_TRUE(c, have_domain))
+				return false;
+		}
+
+		for (; pos < rsp->vects[n].start; pos++)
+			if (rsp->data[pos] == '\n')
+				line++;
+		rc.vect = n;
+		rc.line = line;
+		rc.algo = sect->algo;
+		rc.level = first ? sect->level : 15;
+		first = false;
+
+		rc.mode = TEE_MODE_VERIFY;
+		ac_rsp_cases[ac_rsp_num_cases++] = rc;
+		rc.mode = TEE_MODE_SIGN;
+		ac_rsp_cases[ac_rsp_num_cases++] = rc;
+	}
+	return true;
+}
+
+static void ac_rsp_unload(void)
+{
+	size_t n;
+
+	for (n = 0; n < ARRAY_SIZE(ac_rsps); n++)
+		xtest_rsp_close(ac_rsps + n);
+	free(ac_rsp_cases);
+	ac_rsp_cases = NULL;
+	ac_rsp_num_cases = 0;
+}
+
+static bool ac_rsp_get(const struct xtest_rsp *rsp, size_t n, const char *key,
+		       struct ac_rsp_buf *buf, const uint8_t **val,
+		       size_t *len)
+{
+	size_t l = sizeof(buf->data) - buf->used;
+
+	if (!xtest_rsp_get_bin(rsp, n, key, buf->data + buf->used, &l))
+		return false;
+	*val = buf->data + buf->used;
+	*len = l;
+	buf->used += l;
+	return true;
+}
+
+/* Decodes the case into buf, tv points into it until the next call */
+static bool ac_rsp_decode(const struct ac_rsp_case *rc,
+			  struct ac_rsp_buf *buf, struct xtest_ac_case *tv)
+{
+	const struct xtest_rsp *rsp = rc->rsp;
+	size_t n = rc->vect;
+	const uint8_t *s;
+	size_t s_len;
+
+	memset(tv, 0, sizeof(*tv));
+	tv->level = rc->level;
+	tv->algo = rc->algo;
+	tv->mode = rc->mode;
+	tv->line = rc->line;
+	buf->used = 0;
+
+	if (!ac_rsp_get(rsp, n, "Msg", buf, &tv->ptx, &tv->ptx_len))
+		return false;
+	if (TEE_ALG_GET_MAIN_ALG(rc->algo) == TEE_MAIN_ALGO_DSA) {
+		if (!ac_rsp_get(rsp, rc->domain, "P", buf,
+				&tv->params.dsa.prime,
+				&tv->params.dsa.prime_len) ||
+		    !ac_rsp_get(rsp, rc->domain, "Q", buf,
+				&tv->params.dsa.sub_prime,
+				&tv->params.dsa.sub_prime_len) ||
+		    !ac_rsp_get(rsp, rc->domain, "G", buf,
+				&tv->params.dsa.base,
+				&tv->params.dsa.base_len) ||
+		    !ac_rsp_get(rsp, n, "X", buf, &tv->params.dsa.priv_val,
+				&tv->params.dsa.priv_val_len) ||
+		    !ac_rsp_get(rsp, n, "Y", buf, &tv->params.dsa.pub_val,
+				&tv->params.dsa.pub_val_len))
+			return false;
+	} else {
+		if (!ac_rsp_get(rsp, n, "d", buf, &tv->params.ecdsa.private,
+				&tv->params.ecdsa.private_len) ||
+		    !ac_rsp_get(rsp, n, "Qx", buf, &tv->params.ecdsa.public_x,
+				&tv->params.ecdsa.public_x_len) ||
+		    !ac_rsp_get(rsp, n, "Qy", buf, &tv->params.ecdsa.public_y,
+				&tv->params.ecdsa.public_y_len))
+			return false;
+	}
+	/* S is decoded right after R which gives R || S */
+	if (!ac_rsp_get(rsp, n, "R", buf, &tv->ctx, &tv->ctx_len) ||
+	    !ac_rsp_get(rsp, n, "S", buf, &s, &s_len))
+		return false;
+	tv->ctx_len += s_len;
+	return true;
+}
+
+/*
+ * The attributes are packed into attr_shm which is reused for all the
+ * keys, see xtest_pack_attrs_shm().
+ */
 static bool create_key(ADBG_Case_t *c, TEEC_Session *s,
+		       TEEC_SharedMemory *attr_shm,
 		       uint32_t max_key_size, uint32_t key_type,
 		       TEE_Attribute *attrs, size_t num_attrs,
 		       TEE_ObjectHandle *handle)
 {
+	size_t blen;
 	size_t n;
 
 	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
@@ -3736,8 +3576,12 @@ static bool create_key(ADBG_Case_t *c, TEEC_Session *s,
 		return false;
 
 	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-		ta_crypt_cmd_populate_transient_object(c, s, *handle, attrs,
-			num_attrs)))
+		xtest_pack_attrs_shm(attr_shm, attrs, num_attrs, &blen)))
+		return false;
+
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		ta_crypt_cmd_populate_transient_object_shm(c, s, *handle,
+			attr_shm, blen)))
 		return false;
 
 	for (n = 0; n < num_attrs; n++) {
@@ -3771,486 +3615,648 @@ static bool create_key(ADBG_Case_t *c, TEEC_Session *s,
 	return true;
 }
 
-static void xtest_tee_test_4006(ADBG_Case_t *c)
-{
-	TEEC_Session session = { 0 };
-	TEE_OperationHandle op = TEE_HANDLE_NULL;
-	TEE_ObjectHandle priv_key_handle = TEE_HANDLE_NULL;
-	TEE_ObjectHandle pub_key_handle = TEE_HANDLE_NULL;
-	TEE_Attribute key_attrs[8];
-	TEE_Attribute algo_params[1];
-	size_t num_algo_params;
-	uint8_t out[512];
-	size_t out_size;
-	uint8_t out_enc[512];
-	size_t out_enc_size;
-	uint8_t ptx_hash[TEE_MAX_HASH_SIZE];
-	size_t ptx_hash_size;
+/*
+ * Consecutive vectors often use the same key, for instance a verify and
+ * a sign case of the same NIST vector or a DSA group with a common key.
+ * The key objects and the operations set up with them are kept until
+ * the key material changes.
+ */
+struct ac_key_cache {
+	TEE_ObjectHandle handle;
+	uint32_t key_type;
 	size_t max_key_size;
-	size_t num_key_attrs;
-	uint32_t ret_orig;
-	size_t n;
-	uint32_t curve;
-	uint32_t hash_algo;
+	TEE_Attribute attrs[8];	/* Buffers point into data */
+	size_t num_attrs;
+	uint8_t data[AC_RSP_BUF_SIZE];
+	unsigned int gen;
+	size_t num_reused;
+};
 
-	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-		xtest_teec_open_session(&session, &crypt_user_ta_uuid, NULL,
-			&ret_orig)))
-		return;
+struct ac_op_cache {
+	TEE_OperationHandle op;
+	uint32_t algo;
+	size_t max_key_size;
+	const struct ac_key_cache *key;
+	unsigned int key_gen;
+	size_t num_reused;
+};
 
-	for (n = 0; n < ARRAY_SIZE(xtest_ac_cases); n++) {
-		const struct xtest_ac_case *tv = xtest_ac_cases + n;
+struct ac_cache {
+	struct ac_key_cache pub;
+	struct ac_key_cache priv;
+	/* Indexed by TEE_MODE_ENCRYPT ... TEE_MODE_VERIFY */
+	struct ac_op_cache ops[TEE_MODE_VERIFY + 1];
+	struct ac_op_cache digest;
+};
 
-		if (tv->level > level)
-			continue;
+static bool ac_attrs_equal(const TEE_Attribute *a, size_t num_a,
+			   const TEE_Attribute *b, size_t num_b)
+{
+	size_t n;
 
-		Do_ADBG_BeginSubCase(c, "Asym Crypto case %d algo 0x%x line %d",
-				     (int)n, (unsigned int)tv->algo,
-				     (int)tv->line);
+	if (num_a != num_b)
+		return false;
 
-		/*
-		 * When signing or verifying we're working with the hash of
-		 * the payload.
-		 */
-		if (tv->mode == TEE_MODE_VERIFY || tv->mode == TEE_MODE_SIGN) {
-			if (TEE_ALG_GET_MAIN_ALG(tv->algo) == TEE_MAIN_ALGO_ECDSA)
-				hash_algo = TEE_ALG_SHA1;
-			else
-				hash_algo = TEE_ALG_HASH_ALGO(
-					TEE_ALG_GET_DIGEST_HASH(tv->algo));
+	for (n = 0; n < num_a; n++) {
+		if (a[n].attributeID != b[n].attributeID)
+			return false;
+		if (a[n].attributeID & TEE_ATTR_BIT_VALUE) {
+			if (a[n].content.value.a != b[n].content.value.a ||
+			    a[n].content.value.b != b[n].content.value.b)
+				return false;
+		} else {
+			if (a[n].content.ref.length !=
+			    b[n].content.ref.length ||
+			    memcmp(a[n].content.ref.buffer,
+				   b[n].content.ref.buffer,
+				   a[n].content.ref.length))
+				return false;
+		}
+	}
 
-			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_allocate_operation(c, &session,
-					&op, hash_algo, TEE_MODE_DIGEST, 0)))
-				goto out;
+	return true;
+}
 
-			ptx_hash_size = sizeof(ptx_hash);
-			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_digest_do_final(c, & session, op,
-					tv->ptx, tv->ptx_len, ptx_hash,
-					&ptx_hash_size)))
-				goto out;
+static bool ac_key_cache_attrs(struct ac_key_cache *kc,
+			       const TEE_Attribute *attrs, size_t num_attrs)
+{
+	size_t used = 0;
+	size_t len;
+	size_t n;
 
-			/*
-			 * When we use DSA algorithms, the size of the hash we
-			 * consider equals the min between the size of the
-			 * "subprime" in the key and the size of the hash
-			 */
-			if (TEE_ALG_GET_MAIN_ALG(tv->algo) ==
-			    TEE_MAIN_ALGO_DSA) {
-				if (tv->params.dsa.sub_prime_len <=
-				    ptx_hash_size)
-					ptx_hash_size =
-						tv->params.dsa.sub_prime_len;
-			}
+	for (n = 0; n < num_attrs; n++) {
+		kc->attrs[n] = attrs[n];
+		if (attrs[n].attributeID & TEE_ATTR_BIT_VALUE)
+			continue;
+		len = attrs[n].content.ref.length;
+		if (len > sizeof(kc->data) - used)
+			return false;
+		memcpy(kc->data + used, attrs[n].content.ref.buffer, len);
+		kc->attrs[n].content.ref.buffer = kc->data + used;
+		used += len;
+	}
+	kc->num_attrs = num_attrs;
+	return true;
+}
 
-			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_free_operation(c, &session, op)))
-				goto out;
-		}
+static bool ac_get_key(ADBG_Case_t *c, TEEC_Session *s,
+		       TEEC_SharedMemory *attr_shm, struct ac_key_cache *kc,
+		       size_t max_key_size, uint32_t key_type,
+		       TEE_Attribute *attrs, size_t num_attrs)
+{
+	if (kc->handle != TEE_HANDLE_NULL && kc->key_type == key_type &&
+	    kc->max_key_size == max_key_size &&
+	    ac_attrs_equal(kc->attrs, kc->num_attrs, attrs, num_attrs)) {
+		kc->num_reused++;
+		return true;
+	}
 
-		num_algo_params = 0;
-		num_key_attrs = 0;
-		switch (TEE_ALG_GET_MAIN_ALG(tv->algo)) {
-		case TEE_MAIN_ALGO_RSA:
-			if (tv->params.rsa.salt_len > 0) {
-				algo_params[0].attributeID =
-					TEE_ATTR_RSA_PSS_SALT_LENGTH;
-				algo_params[0].content.value.a =
-					tv->params.rsa.salt_len;
-				algo_params[0].content.value.b = 0;
-				num_algo_params = 1;
-			}
+	if (kc->handle != TEE_HANDLE_NULL) {
+		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+			ta_crypt_cmd_free_transient_object(c, s, kc->handle)))
+			return false;
+		kc->handle = TEE_HANDLE_NULL;
+	}
 
-			max_key_size = tv->params.rsa.modulus_len * 8;
+	kc->gen++;
+	if (!create_key(c, s, attr_shm, max_key_size, key_type, attrs,
+			num_attrs, &kc->handle))
+		return false;
 
-			xtest_add_attr(&num_key_attrs, key_attrs,
-				       TEE_ATTR_RSA_MODULUS,
-				       tv->params.rsa.modulus,
-				       tv->params.rsa.modulus_len);
-			xtest_add_attr(&num_key_attrs, key_attrs,
-				       TEE_ATTR_RSA_PUBLIC_EXPONENT,
-				       tv->params.rsa.pub_exp,
-				       tv->params.rsa.pub_exp_len);
+	/*
+	 * The attributes of a .rsp case point into the buffer of the
+	 * worker, which the next case overwrites, so they're copied.
+	 */
+	if (!ac_key_cache_attrs(kc, attrs, num_attrs)) {
+		/* Too large to compare later, never matches */
+		kc->key_type = 0;
+		kc->num_attrs = 0;
+		return true;
+	}
+	kc->key_type = key_type;
+	kc->max_key_size = max_key_size;
+	return true;
+}
 
-			if (!ADBG_EXPECT_TRUE(c,
-				create_key(c, &session,
-					   max_key_size,
-					   TEE_TYPE_RSA_PUBLIC_KEY,
-					   key_attrs,
-					   num_key_attrs,
-					   &pub_key_handle)))
-				goto out;
+static bool ac_get_op(ADBG_Case_t *c, TEEC_Session *s,
+		      struct ac_cache *cache, uint32_t algo, uint32_t mode,
+		      size_t max_key_size, const struct ac_key_cache *key,
+		      TEE_OperationHandle *op)
+{
+	struct ac_op_cache *oc;
+
+	if (mode == TEE_MODE_DIGEST)
+		oc = &cache->digest;
+	else
+		oc = cache->ops + mode;
+
+	if (oc->op != TEE_HANDLE_NULL && oc->algo == algo &&
+	    oc->max_key_size == max_key_size && oc->key == key &&
+	    (!key || oc->key_gen == key->gen)) {
+		oc->num_reused++;
+		*op = oc->op;
+		return true;
+	}
 
-			xtest_add_attr(&num_key_attrs, key_attrs,
-				       TEE_ATTR_RSA_PRIVATE_EXPONENT,
-				       tv->params.rsa.priv_exp,
-				       tv->params.rsa.priv_exp_len);
-
-			if (tv->params.rsa.prime1_len != 0) {
-				xtest_add_attr(&num_key_attrs, key_attrs,
-					       TEE_ATTR_RSA_PRIME1,
-					       tv->params.rsa.prime1,
-					       tv->params.rsa.prime1_len);
-			}
+	if (oc->op != TEE_HANDLE_NULL) {
+		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+			ta_crypt_cmd_free_operation(c, s, oc->op)))
+			return false;
+		oc->op = TEE_HANDLE_NULL;
+	}
 
-			if (tv->params.rsa.prime2_len != 0) {
-				xtest_add_attr(&num_key_attrs, key_attrs,
-			       TEE_ATTR_RSA_PRIME2,
-			       tv->params.rsa.prime2,
-			       tv->params.rsa.prime2_len);
-			}
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		ta_crypt_cmd_allocate_operation(c, s, &oc->op, algo, mode,
+						max_key_size)))
+		return false;
 
-			if (tv->params.rsa.exp1_len != 0) {
-				xtest_add_attr(&num_key_attrs, key_attrs,
-			       TEE_ATTR_RSA_EXPONENT1,
-			       tv->params.rsa.exp1,
-			       tv->params.rsa.exp1_len);
-			}
+	/* Key objects are only released when the key changes */
+	if (key && !ADBG_EXPECT_TEEC_SUCCESS(c,
+			ta_crypt_cmd_set_operation_key(c, s, oc->op,
+						       key->handle))) {
+		ta_crypt_cmd_free_operation(c, s, oc->op);
+		oc->op = TEE_HANDLE_NULL;
+		return false;
+	}
 
-			if (tv->params.rsa.exp2_len != 0) {
-				xtest_add_attr(&num_key_attrs, key_attrs,
-			       TEE_ATTR_RSA_EXPONENT2,
-			       tv->params.rsa.exp2,
-			       tv->params.rsa.exp2_len);
-			}
+	oc->algo = algo;
+	oc->max_key_size = max_key_size;
+	oc->key = key;
+	oc->key_gen = key ? key->gen : 0;
+	*op = oc->op;
+	return true;
+}
 
-			if (tv->params.rsa.coeff_len != 0) {
-				xtest_add_attr(&num_key_attrs, key_attrs,
-			       TEE_ATTR_RSA_COEFFICIENT,
-			       tv->params.rsa.coeff,
-			       tv->params.rsa.coeff_len);
-			}
+static void ac_cache_free(ADBG_Case_t *c, TEEC_Session *s,
+			  struct ac_cache *cache)
+{
+	size_t n;
 
-			if (!ADBG_EXPECT_TRUE(c,
-			      create_key(c, &session,
-				 max_key_size,
-				 TEE_TYPE_RSA_KEYPAIR,
-				 key_attrs,
-				 num_key_attrs,
-				 &priv_key_handle)))
-				goto out;
-			break;
+	for (n = 0; n < ARRAY_SIZE(cache->ops); n++)
+		if (cache->ops[n].op != TEE_HANDLE_NULL)
+			ta_crypt_cmd_free_operation(c, s, cache->ops[n].op);
+	if (cache->digest.op != TEE_HANDLE_NULL)
+		ta_crypt_cmd_free_operation(c, s, cache->digest.op);
+	if (cache->pub.handle != TEE_HANDLE_NULL)
+		ta_crypt_cmd_free_transient_object(c, s, cache->pub.handle);
+	if (cache->priv.handle != TEE_HANDLE_NULL)
+		ta_crypt_cmd_free_transient_object(c, s, cache->priv.handle);
+}
 
-		case TEE_MAIN_ALGO_DSA:
-			max_key_size = tv->params.dsa.prime_len * 8;
+struct ac_worker {
+	TEEC_SharedMemory attr_shm;
+	struct ac_cache cache;
+	struct ac_rsp_buf rsp_buf;
+};
 
-			xtest_add_attr(&num_key_attrs, key_attrs,
-				       TEE_ATTR_DSA_PRIME,
-				       tv->params.dsa.prime,
-				       tv->params.dsa.prime_len);
-			xtest_add_attr(&num_key_attrs, key_attrs,
-				       TEE_ATTR_DSA_SUBPRIME,
-				       tv->params.dsa.sub_prime,
-				       tv->params.dsa.sub_prime_len);
-			xtest_add_attr(&num_key_attrs, key_attrs,
-				       TEE_ATTR_DSA_BASE,
-				       tv->params.dsa.base,
-				       tv->params.dsa.base_len);
-			xtest_add_attr(&num_key_attrs, key_attrs,
-				       TEE_ATTR_DSA_PUBLIC_VALUE,
-				       tv->params.dsa.pub_val,
-				       tv->params.dsa.pub_val_len);
+static bool ac_title(size_t n, char *buf, size_t len)
+{
+	const struct xtest_ac_case *tv;
+	const struct ac_rsp_case *rc;
 
-			if (!ADBG_EXPECT_TRUE(c,
-				create_key(c, &session, max_key_size,
-					   TEE_TYPE_DSA_PUBLIC_KEY, key_attrs,
-					   num_key_attrs, &pub_key_handle)))
-				goto out;
+	if (n < ARRAY_SIZE(xtest_ac_cases)) {
+		tv = xtest_ac_cases + n;
+		if (tv->level > level)
+			return false;
+		snprintf(buf, len, "Asym Crypto case %d algo 0x%x line %d",
+			 (int)n, (unsigned int)tv->algo, (int)tv->line);
+		return true;
+	}
 
-			xtest_add_attr(&num_key_attrs, key_attrs,
-				       TEE_ATTR_DSA_PRIVATE_VALUE,
-				       tv->params.dsa.priv_val,
-				       tv->params.dsa.priv_val_len);
+	rc = ac_rsp_cases + n - ARRAY_SIZE(xtest_ac_cases);
+	if (rc->level > level)
+		return false;
+	snprintf(buf, len, "Asym Crypto case %d algo 0x%x %s line %d",
+		 (int)n, (unsigned int)rc->algo, rc->file, (int)rc->line);
+	return true;
+}
 
-			if (!ADBG_EXPECT_TRUE(c,
-				create_key(c, &session, max_key_size,
-					   TEE_TYPE_DSA_KEYPAIR, key_attrs,
-					   num_key_attrs, &priv_key_handle)))
-				goto out;
-			break;
+static bool ac_worker_init(ADBG_Case_t *c, TEEC_Session *s, void **priv)
+{
+	struct ac_worker *w = calloc(1, sizeof(*w));
 
-		case TEE_MAIN_ALGO_ECDSA:
-			switch (tv->algo) {
-			case TEE_ALG_ECDSA_P192:
-				curve = TEE_ECC_CURVE_NIST_P192;
-				break;
-			case TEE_ALG_ECDSA_P224:
-				curve = TEE_ECC_CURVE_NIST_P224;
-				break;
-			case TEE_ALG_ECDSA_P256:
-				curve = TEE_ECC_CURVE_NIST_P256;
-				break;
-			case TEE_ALG_ECDSA_P384:
-				curve = TEE_ECC_CURVE_NIST_P384;
-				break;
-			case TEE_ALG_ECDSA_P521:
-				curve = TEE_ECC_CURVE_NIST_P521;
-				break;
-			default:
-				curve = 0xFF;
-				break;
-			}
-
-			if (tv->algo == TEE_ALG_ECDSA_P521)
-				max_key_size = 521;
-			else
-				max_key_size = tv->params.ecdsa.private_len * 8;
+	(void)s;
+	if (!ADBG_EXPECT_NOT_NULL(c, w))
+		return false;
+	*priv = w;
+	return true;
+}
 
-			xtest_add_attr_value(&num_key_attrs, key_attrs,
-					     TEE_ATTR_ECC_CURVE, curve, 0);
-			xtest_add_attr(&num_key_attrs, key_attrs,
-				       TEE_ATTR_ECC_PUBLIC_VALUE_X,
-				       tv->params.ecdsa.public_x,
-				       tv->params.ecdsa.public_x_len);
-			xtest_add_attr(&num_key_attrs, key_attrs,
-				       TEE_ATTR_ECC_PUBLIC_VALUE_Y,
-				       tv->params.ecdsa.public_y,
-				       tv->params.ecdsa.public_y_len);
+static void ac_worker_fini(ADBG_Case_t *c, TEEC_Session *s, void *priv)
+{
+	struct ac_worker *w = priv;
+
+	Do_ADBG_Log("    Reused keys: %zu, operations: %zu",
+		    w->cache.pub.num_reused + w->cache.priv.num_reused,
+		    w->cache.ops[TEE_MODE_ENCRYPT].num_reused +
+		    w->cache.ops[TEE_MODE_DECRYPT].num_reused +
+		    w->cache.ops[TEE_MODE_SIGN].num_reused +
+		    w->cache.ops[TEE_MODE_VERIFY].num_reused +
+		    w->cache.digest.num_reused);
+
+	ac_cache_free(c, s, &w->cache);
+	if (w->attr_shm.buffer)
+		TEEC_ReleaseSharedMemory(&w->attr_shm);
+	free(w);
+}
 
-			if (!ADBG_EXPECT_TRUE(c,
-				create_key(c, &session, max_key_size,
-					   TEE_TYPE_ECDSA_PUBLIC_KEY, key_attrs,
-					   num_key_attrs, &pub_key_handle)))
-				goto out;
+static void ac_run_vector(ADBG_Case_t *c, TEEC_Session *s, void *priv,
+			  size_t n)
+{
+	const struct xtest_ac_case *tv;
+	struct xtest_ac_case rsp_tv;
+	struct ac_worker *w = priv;
+	TEE_OperationHandle op = TEE_HANDLE_NULL;
+	TEE_Attribute key_attrs[8];
+	TEE_Attribute algo_params[1];
+	size_t num_algo_params;
+	uint8_t out[512];
+	size_t out_size;
+	uint8_t out_enc[512];
+	size_t out_enc_size;
+	uint8_t ptx_hash[TEE_MAX_HASH_SIZE];
+	size_t ptx_hash_size;
+	size_t max_key_size;
+	size_t num_key_attrs;
+	uint32_t curve;
+	uint32_t hash_algo;
 
-			xtest_add_attr(&num_key_attrs, key_attrs,
-				       TEE_ATTR_ECC_PRIVATE_VALUE,
-				       tv->params.ecdsa.private,
-				       tv->params.ecdsa.private_len);
+	if (n < ARRAY_SIZE(xtest_ac_cases)) {
+		tv = xtest_ac_cases + n;
+	} else {
+		if (!ADBG_EXPECT_TRUE(c,
+			ac_rsp_decode(ac_rsp_cases + n -
+					ARRAY_SIZE(xtest_ac_cases),
+				      &w->rsp_buf, &rsp_tv)))
+			return;
+		tv = &rsp_tv;
+	}
 
-			if (!ADBG_EXPECT_TRUE(c,
-				create_key(c, &session, max_key_size,
-					   TEE_TYPE_ECDSA_KEYPAIR, key_attrs,
-					   num_key_attrs, &priv_key_handle)))
-				goto out;
-			break;
+	/*
+	 * When signing or verifying we're working with the hash of
+	 * the payload.
+	 */
+	if (tv->mode == TEE_MODE_VERIFY || tv->mode == TEE_MODE_SIGN) {
+		if (TEE_ALG_GET_MAIN_ALG(tv->algo) == TEE_MAIN_ALGO_ECDSA)
+			hash_algo = TEE_ALG_SHA1;
+		else
+			hash_algo = TEE_ALG_HASH_ALGO(
+				TEE_ALG_GET_DIGEST_HASH(tv->algo));
 
-		default:
-			ADBG_EXPECT_TRUE(c, false);
+		if (!ADBG_EXPECT_TRUE(c,
+			ac_get_op(c, s, &w->cache, hash_algo,
+				  TEE_MODE_DIGEST, 0, NULL, &op)))
 			goto out;
-		}
 
-		out_size = sizeof(out);
-		memset(out, 0, sizeof(out));
-		switch (tv->mode) {
-		case TEE_MODE_ENCRYPT:
-			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_allocate_operation(c, &session,
-					&op, tv->algo, TEE_MODE_ENCRYPT,
-					max_key_size)))
-				goto out;
+		ptx_hash_size = sizeof(ptx_hash);
+		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+			ta_crypt_cmd_digest_do_final(c, s, op,
+				tv->ptx, tv->ptx_len, ptx_hash,
+				&ptx_hash_size)))
+			goto out;
 
-			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_set_operation_key(c, &session, op,
-					pub_key_handle)))
-				goto out;
+		/*
+		 * When we use DSA algorithms, the size of the hash we
+		 * consider equals the min between the size of the
+		 * "subprime" in the key and the size of the hash
+		 */
+		if (TEE_ALG_GET_MAIN_ALG(tv->algo) ==
+		    TEE_MAIN_ALGO_DSA) {
+			if (tv->params.dsa.sub_prime_len <=
+			    ptx_hash_size)
+				ptx_hash_size =
+					tv->params.dsa.sub_prime_len;
+		}
+	}
 
-			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_free_transient_object(c, &session,
-					pub_key_handle)))
-				goto out;
-			pub_key_handle = TEE_HANDLE_NULL;
+	num_algo_params = 0;
+	num_key_attrs = 0;
+	switch (TEE_ALG_GET_MAIN_ALG(tv->algo)) {
+	case TEE_MAIN_ALGO_RSA:
+		if (tv->params.rsa.salt_len > 0) {
+			algo_params[0].attributeID =
+				TEE_ATTR_RSA_PSS_SALT_LENGTH;
+			algo_params[0].content.value.a =
+				tv->params.rsa.salt_len;
+			algo_params[0].content.value.b = 0;
+			num_algo_params = 1;
+		}
 
-			out_enc_size = sizeof(out_enc);
-			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_asymmetric_encrypt(c, &session, op,
-					NULL, 0, tv->ptx, tv->ptx_len, out_enc,
-					&out_enc_size)))
-				goto out;
+		max_key_size = tv->params.rsa.modulus_len * 8;
 
-			/*
-			 * A PS which is random is added when formatting the
-			 * message internally of the algorithm so we can't
-			 * verify against precomputed values, instead we use the
-			 * decrypt operation to see that output is correct.
-			 */
+		xtest_add_attr(&num_key_attrs, key_attrs,
+			       TEE_ATTR_RSA_MODULUS,
+			       tv->params.rsa.modulus,
+			       tv->params.rsa.modulus_len);
+		xtest_add_attr(&num_key_attrs, key_attrs,
+			       TEE_ATTR_RSA_PUBLIC_EXPONENT,
+			       tv->params.rsa.pub_exp,
+			       tv->params.rsa.pub_exp_len);
 
-			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_free_operation(c, &session, op)))
-				goto out;
+		if (!ADBG_EXPECT_TRUE(c,
+			ac_get_key(c, s, &w->attr_shm,
+				   &w->cache.pub, max_key_size,
+				   TEE_TYPE_RSA_PUBLIC_KEY, key_attrs,
+				   num_key_attrs)))
+			goto out;
 
-			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_allocate_operation(c, &session,
-					&op, tv->algo, TEE_MODE_DECRYPT,
-					max_key_size)))
-				goto out;
+		xtest_add_attr(&num_key_attrs, key_attrs,
+			       TEE_ATTR_RSA_PRIVATE_EXPONENT,
+			       tv->params.rsa.priv_exp,
+			       tv->params.rsa.priv_exp_len);
 
-			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_set_operation_key(c, &session, op,
-					priv_key_handle)))
-				goto out;
+		if (tv->params.rsa.prime1_len != 0) {
+			xtest_add_attr(&num_key_attrs, key_attrs,
+				       TEE_ATTR_RSA_PRIME1,
+				       tv->params.rsa.prime1,
+				       tv->params.rsa.prime1_len);
+		}
 
-			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_free_transient_object(c, &session,
-					priv_key_handle)))
-				goto out;
+		if (tv->params.rsa.prime2_len != 0) {
+			xtest_add_attr(&num_key_attrs, key_attrs,
+		       TEE_ATTR_RSA_PRIME2,
+		       tv->params.rsa.prime2,
+		       tv->params.rsa.prime2_len);
+		}
 
-			priv_key_handle = TEE_HANDLE_NULL;
+		if (tv->params.rsa.exp1_len != 0) {
+			xtest_add_attr(&num_key_attrs, key_attrs,
+		       TEE_ATTR_RSA_EXPONENT1,
+		       tv->params.rsa.exp1,
+		       tv->params.rsa.exp1_len);
+		}
 
-			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_asymmetric_decrypt(c, &session, op,
-					NULL, 0, out_enc, out_enc_size, out,
-					&out_size)))
-				goto out;
+		if (tv->params.rsa.exp2_len != 0) {
+			xtest_add_attr(&num_key_attrs, key_attrs,
+		       TEE_ATTR_RSA_EXPONENT2,
+		       tv->params.rsa.exp2,
+		       tv->params.rsa.exp2_len);
+		}
 
-			(void)ADBG_EXPECT_BUFFER(c, tv->ptx, tv->ptx_len, out,
-						 out_size);
-			break;
+		if (tv->params.rsa.coeff_len != 0) {
+			xtest_add_attr(&num_key_attrs, key_attrs,
+		       TEE_ATTR_RSA_COEFFICIENT,
+		       tv->params.rsa.coeff,
+		       tv->params.rsa.coeff_len);
+		}
 
-		case TEE_MODE_DECRYPT:
-			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_allocate_operation(c, &session,
-					&op, tv->algo, TEE_MODE_DECRYPT,
-					max_key_size)))
-				goto out;
+		if (!ADBG_EXPECT_TRUE(c,
+			ac_get_key(c, s, &w->attr_shm,
+				   &w->cache.priv, max_key_size,
+				   TEE_TYPE_RSA_KEYPAIR, key_attrs,
+				   num_key_attrs)))
+			goto out;
+		break;
 
-			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_set_operation_key(c, &session, op,
-					priv_key_handle)))
-				goto out;
+	case TEE_MAIN_ALGO_DSA:
+		max_key_size = tv->params.dsa.prime_len * 8;
+
+		xtest_add_attr(&num_key_attrs, key_attrs,
+			       TEE_ATTR_DSA_PRIME,
+			       tv->params.dsa.prime,
+			       tv->params.dsa.prime_len);
+		xtest_add_attr(&num_key_attrs, key_attrs,
+			       TEE_ATTR_DSA_SUBPRIME,
+			       tv->params.dsa.sub_prime,
+			       tv->params.dsa.sub_prime_len);
+		xtest_add_attr(&num_key_attrs, key_attrs,
+			       TEE_ATTR_DSA_BASE,
+			       tv->params.dsa.base,
+			       tv->params.dsa.base_len);
+		xtest_add_attr(&num_key_attrs, key_attrs,
+			       TEE_ATTR_DSA_PUBLIC_VALUE,
+			       tv->params.dsa.pub_val,
+			       tv->params.dsa.pub_val_len);
 
-			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_free_transient_object(c, &session,
-					priv_key_handle)))
-				goto out;
+		if (!ADBG_EXPECT_TRUE(c,
+			ac_get_key(c, s, &w->attr_shm,
+				   &w->cache.pub, max_key_size,
+				   TEE_TYPE_DSA_PUBLIC_KEY, key_attrs,
+				   num_key_attrs)))
+			goto out;
 
-			priv_key_handle = TEE_HANDLE_NULL;
+		xtest_add_attr(&num_key_attrs, key_attrs,
+			       TEE_ATTR_DSA_PRIVATE_VALUE,
+			       tv->params.dsa.priv_val,
+			       tv->params.dsa.priv_val_len);
 
-			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_asymmetric_decrypt(c, &session, op,
-					NULL, 0, tv->ctx, tv->ctx_len, out,
-					&out_size)))
-				goto out;
+		if (!ADBG_EXPECT_TRUE(c,
+			ac_get_key(c, s, &w->attr_shm,
+				   &w->cache.priv, max_key_size,
+				   TEE_TYPE_DSA_KEYPAIR, key_attrs,
+				   num_key_attrs)))
+			goto out;
+		break;
 
-			(void)ADBG_EXPECT_BUFFER(c, tv->ptx, tv->ptx_len, out,
-						 out_size);
+	case TEE_MAIN_ALGO_ECDSA:
+		switch (tv->algo) {
+		case TEE_ALG_ECDSA_P192:
+			curve = TEE_ECC_CURVE_NIST_P192;
 			break;
+		case TEE_ALG_ECDSA_P224:
+			curve = TEE_ECC_CURVE_NIST_P224;
+			break;
+		case TEE_ALG_ECDSA_P256:
+			curve = TEE_ECC_CURVE_NIST_P256;
+			break;
+		case TEE_ALG_ECDSA_P384:
+			curve = TEE_ECC_CURVE_NIST_P384;
+			break;
+		case TEE_ALG_ECDSA_P521:
+			curve = TEE_ECC_CURVE_NIST_P521;
+			break;
+		default:
+			curve = 0xFF;
+			break;
+		}
 
-		case TEE_MODE_VERIFY:
-			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_allocate_operation(c, &session,
-					&op, tv->algo, TEE_MODE_VERIFY,
-					max_key_size)))
-				goto out;
-
-			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_set_operation_key(c, &session, op,
-					pub_key_handle)))
-				goto out;
+		if (tv->algo == TEE_ALG_ECDSA_P521)
+			max_key_size = 521;
+		else
+			max_key_size = tv->params.ecdsa.private_len * 8;
 
-			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_free_transient_object(c, &session,
-					pub_key_handle)))
-				goto out;
+		xtest_add_attr_value(&num_key_attrs, key_attrs,
+				     TEE_ATTR_ECC_CURVE, curve, 0);
+		xtest_add_attr(&num_key_attrs, key_attrs,
+			       TEE_ATTR_ECC_PUBLIC_VALUE_X,
+			       tv->params.ecdsa.public_x,
+			       tv->params.ecdsa.public_x_len);
+		xtest_add_attr(&num_key_attrs, key_attrs,
+			       TEE_ATTR_ECC_PUBLIC_VALUE_Y,
+			       tv->params.ecdsa.public_y,
+			       tv->params.ecdsa.public_y_len);
 
-			pub_key_handle = TEE_HANDLE_NULL;
+		if (!ADBG_EXPECT_TRUE(c,
+			ac_get_key(c, s, &w->attr_shm,
+				   &w->cache.pub, max_key_size,
+				   TEE_TYPE_ECDSA_PUBLIC_KEY, key_attrs,
+				   num_key_attrs)))
+			goto out;
 
-			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_asymmetric_verify(c, &session, op,
-					algo_params, num_algo_params, ptx_hash,
-					ptx_hash_size, tv->ctx, tv->ctx_len)))
-				goto out;
-			break;
+		xtest_add_attr(&num_key_attrs, key_attrs,
+			       TEE_ATTR_ECC_PRIVATE_VALUE,
+			       tv->params.ecdsa.private,
+			       tv->params.ecdsa.private_len);
 
-		case TEE_MODE_SIGN:
-			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_allocate_operation(c, &session,
-					&op, tv->algo, TEE_MODE_SIGN,
-					max_key_size)))
-				goto out;
+		if (!ADBG_EXPECT_TRUE(c,
+			ac_get_key(c, s, &w->attr_shm,
+				   &w->cache.priv, max_key_size,
+				   TEE_TYPE_ECDSA_KEYPAIR, key_attrs,
+				   num_key_attrs)))
+			goto out;
+		break;
 
-			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_set_operation_key(c, &session, op,
-					priv_key_handle)))
-				goto out;
+	default:
+		ADBG_EXPECT_TRUE(c, false);
+		goto out;
+	}
 
-			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_free_transient_object(c, &session,
-					priv_key_handle)))
-				goto out;
+	out_size = sizeof(out);
+	memset(out, 0, sizeof(out));
+	switch (tv->mode) {
+	case TEE_MODE_ENCRYPT:
+		if (!ADBG_EXPECT_TRUE(c,
+			ac_get_op(c, s, &w->cache, tv->algo,
+				  TEE_MODE_ENCRYPT, max_key_size,
+				  &w->cache.pub, &op)))
+			goto out;
 
-			priv_key_handle = TEE_HANDLE_NULL;
+		out_enc_size = sizeof(out_enc);
+		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+			ta_crypt_cmd_asymmetric_encrypt(c, s, op,
+				NULL, 0, tv->ptx, tv->ptx_len, out_enc,
+				&out_enc_size)))
+			goto out;
 
-			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_asymmetric_sign(c, &session, op,
-					algo_params, num_algo_params, ptx_hash,
-					ptx_hash_size, out, &out_size)))
-				goto out;
+		/*
+		 * A PS which is random is added when formatting the
+		 * message internally of the algorithm so we can't
+		 * verify against precomputed values, instead we use the
+		 * decrypt operation to see that output is correct.
+		 */
+		if (!ADBG_EXPECT_TRUE(c,
+			ac_get_op(c, s, &w->cache, tv->algo,
+				  TEE_MODE_DECRYPT, max_key_size,
+				  &w->cache.priv, &op)))
+			goto out;
 
-			if (TEE_ALG_GET_CHAIN_MODE(tv->algo) ==
-			    TEE_CHAIN_MODE_PKCS1_PSS_MGF1 ||
-			    tv->algo == TEE_ALG_DSA_SHA1 ||
-			    tv->algo == TEE_ALG_DSA_SHA224 ||
-			    tv->algo == TEE_ALG_DSA_SHA256 ||
-			    TEE_ALG_GET_MAIN_ALG(tv->algo) ==
-					    TEE_MAIN_ALGO_ECDSA) {
-				if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-					ta_crypt_cmd_free_operation(c, &session,
-								    op)))
-					goto out;
-				/*
-				 * The salt or K is random so we can't verify
-				 * signing against precomputed values, instead
-				 * we use the verify operation to see that
-				 * output is correct.
-				 */
-				if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-					ta_crypt_cmd_allocate_operation(c,
-						&session, &op, tv->algo,
-						TEE_MODE_VERIFY, max_key_size)))
-					goto out;
+		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+			ta_crypt_cmd_asymmetric_decrypt(c, s, op,
+				NULL, 0, out_enc, out_enc_size, out,
+				&out_size)))
+			goto out;
 
-				if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-					ta_crypt_cmd_set_operation_key(c,
-						&session, op, pub_key_handle)))
-					goto out;
+		(void)ADBG_EXPECT_BUFFER(c, tv->ptx, tv->ptx_len, out,
+					 out_size);
+		break;
 
-				if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-					ta_crypt_cmd_free_transient_object(c,
-						&session, pub_key_handle)))
-					goto out;
+	case TEE_MODE_DECRYPT:
+		if (!ADBG_EXPECT_TRUE(c,
+			ac_get_op(c, s, &w->cache, tv->algo,
+				  TEE_MODE_DECRYPT, max_key_size,
+				  &w->cache.priv, &op)))
+			goto out;
 
-				pub_key_handle = TEE_HANDLE_NULL;
+		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+			ta_crypt_cmd_asymmetric_decrypt(c, s, op,
+				NULL, 0, tv->ctx, tv->ctx_len, out,
+				&out_size)))
+			goto out;
 
-				if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-					ta_crypt_cmd_asymmetric_verify(c,
-						&session, op, algo_params,
-						num_algo_params, ptx_hash,
-						ptx_hash_size, out, out_size)))
-					goto out;
-			} else {
-				(void)ADBG_EXPECT_BUFFER(c, tv->ctx,
-							 tv->ctx_len, out,
-							 out_size);
-			}
-			break;
+		(void)ADBG_EXPECT_BUFFER(c, tv->ptx, tv->ptx_len, out,
+					 out_size);
+		break;
 
-		default:
-			break;
-		}
+	case TEE_MODE_VERIFY:
+		if (!ADBG_EXPECT_TRUE(c,
+			ac_get_op(c, s, &w->cache, tv->algo,
+				  TEE_MODE_VERIFY, max_key_size,
+				  &w->cache.pub, &op)))
+			goto out;
 
 		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-			ta_crypt_cmd_free_operation(c, &session, op)))
+			ta_crypt_cmd_asymmetric_verify(c, s, op,
+				algo_params, num_algo_params, ptx_hash,
+				ptx_hash_size, tv->ctx, tv->ctx_len)))
 			goto out;
+		break;
 
-		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-			ta_crypt_cmd_free_transient_object(c, &session,
-				pub_key_handle)))
+	case TEE_MODE_SIGN:
+		if (!ADBG_EXPECT_TRUE(c,
+			ac_get_op(c, s, &w->cache, tv->algo,
+				  TEE_MODE_SIGN, max_key_size,
+				  &w->cache.priv, &op)))
 			goto out;
-		pub_key_handle = TEE_HANDLE_NULL;
 
 		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-			ta_crypt_cmd_free_transient_object(c, &session,
-				priv_key_handle)))
+			ta_crypt_cmd_asymmetric_sign(c, s, op,
+				algo_params, num_algo_params, ptx_hash,
+				ptx_hash_size, out, &out_size)))
 			goto out;
 
-		priv_key_handle = TEE_HANDLE_NULL;
+		if (TEE_ALG_GET_CHAIN_MODE(tv->algo) ==
+		    TEE_CHAIN_MODE_PKCS1_PSS_MGF1 ||
+		    tv->algo == TEE_ALG_DSA_SHA1 ||
+		    tv->algo == TEE_ALG_DSA_SHA224 ||
+		    tv->algo == TEE_ALG_DSA_SHA256 ||
+		    TEE_ALG_GET_MAIN_ALG(tv->algo) ==
+				    TEE_MAIN_ALGO_ECDSA) {
+			/*
+			 * The salt or K is random so we can't verify
+			 * signing against precomputed values, instead
+			 * we use the verify operation to see that
+			 * output is correct.
+			 */
+			if (!ADBG_EXPECT_TRUE(c,
+				ac_get_op(c, s, &w->cache, tv->algo,
+					  TEE_MODE_VERIFY, max_key_size,
+					  &w->cache.pub, &op)))
+				goto out;
+
+			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+				ta_crypt_cmd_asymmetric_verify(c,
+					s, op, algo_params,
+					num_algo_params, ptx_hash,
+					ptx_hash_size, out, out_size)))
+				goto out;
+		} else {
+			(void)ADBG_EXPECT_BUFFER(c, tv->ctx,
+						 tv->ctx_len, out,
+						 out_size);
+		}
+		break;
 
-		Do_ADBG_EndSubCase(c, NULL);
+	default:
+		break;
 	}
+
+	return;
 out:
-	TEEC_CloseSession(&session);
+	/* Don't trust anything cached after a failure */
+	ac_cache_free(c, s, &w->cache);
+	memset(&w->cache, 0, sizeof(w->cache));
+}
+
+static const struct xtest_vector_ops ac_vector_ops = {
+	.title = ac_title,
+	.worker_init = ac_worker_init,
+	.worker_fini = ac_worker_fini,
+	.run = ac_run_vector,
+};
+
+static void xtest_tee_test_4006(ADBG_Case_t *c)
+{
+	struct xtest_vector_ops ops = ac_vector_ops;
+	size_t n;
+
+	for (n = 0; n < ARRAY_SIZE(ac_rsp_files); n++)
+		if (!ac_rsp_load(c, ac_rsp_files + n, ac_rsps + n))
+			goto out;
+
+	ops.num_vectors = ARRAY_SIZE(xtest_ac_cases) + ac_rsp_num_cases;
+	xtest_run_vectors(c, &crypt_user_ta_uuid, &ops);
+out:
+	ac_rsp_unload();
 }
 
 #define KEY_ATTR(x, y) { #x, (x), y }
@@ -4757,8 +4763,8 @@ static void xtest_tee_test_4007(ADBG_Case_t *c)
 	uint32_t ret_orig;
 
 	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-		xtest_teec_open_session(&session, &crypt_user_ta_uuid, NULL,
-					&ret_orig)))
+		xtest_teec_lease_session(c, &session, &crypt_user_ta_uuid,
+					 &ret_orig)))
 		return;
 
 	xtest_test_keygen_noparams(c, &session);
@@ -4769,7 +4775,7 @@ static void xtest_tee_test_4007(ADBG_Case_t *c)
 
 	xtest_test_keygen_ecc (c, &session);
 
-	TEEC_CloseSession(&session);
+	xtest_teec_release_session(c, &session);
 }
 
 static void xtest_tee_test_4008(ADBG_Case_t *c)
@@ -4785,8 +4791,8 @@ static void xtest_tee_test_4008(ADBG_Case_t *c)
 	size_t out_size;
 
 	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-		xtest_teec_open_session(&session, &crypt_user_ta_uuid, NULL,
-					&ret_orig)))
+		xtest_teec_lease_session(c, &session, &crypt_user_ta_uuid,
+					 &ret_orig)))
 		return;
 
 	Do_ADBG_BeginSubCase(c, "Derive DH key success");
@@ -4866,13 +4872,75 @@ static void xtest_tee_test_4008(ADBG_Case_t *c)
 		goto out;
 out:
 	Do_ADBG_EndSubCase(c, "Derive DH key success");
-	TEEC_CloseSession(&session);
+	xtest_teec_release_session(c, &session);
 }
 
-static void xtest_tee_test_4009(ADBG_Case_t *c)
+#define ECDH_RSP_FILE		"KAS_ECC_CDH_PrimitiveTest.rsp"
+#define ECDH_MAX_SIZE		((521 + 7) / 8)
+
+static const struct ecdh_curve {
+	const char *name;	/* section in ECDH_RSP_FILE */
+	uint32_t algo;		/* TEE_ALG_ECDH_P192,... */
+	uint32_t curve;		/* TEE_ECC_CURVE_NIST_P192,... */
+	uint32_t keysize;	/* key size, in bits */
+} ecdh_curves[] = {
+	{ "P-192", TEE_ALG_ECDH_P192, TEE_ECC_CURVE_NIST_P192, 192 },
+	{ "P-224", TEE_ALG_ECDH_P224, TEE_ECC_CURVE_NIST_P224, 224 },
+	{ "P-256", TEE_ALG_ECDH_P256, TEE_ECC_CURVE_NIST_P256, 256 },
+	{ "P-384", TEE_ALG_ECDH_P384, TEE_ECC_CURVE_NIST_P384, 384 },
+	{ "P-521", TEE_ALG_ECDH_P521, TEE_ECC_CURVE_NIST_P521, 521 },
+};
+
+static struct xtest_rsp ecdh_rsp;
+
+static const struct ecdh_curve *ecdh_get_curve(size_t n)
 {
-	TEEC_Session session = { 0 };
-	uint32_t ret_orig;
+	size_t i;
+
+	for (i = 0; i < ARRAY_SIZE(ecdh_curves); i++)
+		if (xtest_rsp_in_section(&ecdh_rsp, n, ecdh_curves[i].name))
+			return ecdh_curves + i;
+	return NULL;
+}
+
+/* The first two vectors of each curve run at level 0 and 1, the rest 15 */
+static uint32_t ecdh_get_level(size_t n)
+{
+	unsigned long count;
+
+	if (!xtest_rsp_get_uint(&ecdh_rsp, n, "COUNT", &count) || count > 1)
+		return 15;
+	return count;
+}
+
+static bool ecdh_get_value(size_t n, const char *key, uint8_t *buf,
+			   size_t size)
+{
+	size_t len = size;
+
+	return xtest_rsp_get_bin(&ecdh_rsp, n, key, buf, &len) && len == size;
+}
+
+static bool ecdh_title(size_t n, char *buf, size_t len)
+{
+	const struct ecdh_curve *pt = ecdh_get_curve(n);
+
+	/* Curves that GP doesn't support are skipped */
+	if (!pt || ecdh_get_level(n) > level)
+		return false;
+
+	snprintf(buf, len, "Derive ECDH key - algo = 0x%x", pt->algo);
+	return true;
+}
+
+static void ecdh_run_vector(ADBG_Case_t *c, TEEC_Session *s, void *priv,
+			    size_t n)
+{
+	const struct ecdh_curve *pt = ecdh_get_curve(n);
+	uint8_t public_x[ECDH_MAX_SIZE];	/* QCAVSx */
+	uint8_t public_y[ECDH_MAX_SIZE];	/* QCAVSy */
+	uint8_t private[ECDH_MAX_SIZE];		/* dIUT */
+	uint8_t expect[ECDH_MAX_SIZE];		/* ZIUT */
 	TEE_OperationHandle op;
 	TEE_ObjectHandle key_handle;
 	TEE_ObjectHandle sv_handle;
@@ -4881,121 +4949,123 @@ static void xtest_tee_test_4009(ADBG_Case_t *c)
 	uint8_t out[2048];
 	size_t out_size;
 	uint32_t size_bytes;
-	uint32_t i;
-	struct derive_key_ecdh_t *pt;
 
-	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-		xtest_teec_open_session(&session, &crypt_user_ta_uuid, NULL,
-					&ret_orig)))
+	(void)priv;
+	size_bytes = (pt->keysize + 7) / 8;
+	if (!ADBG_EXPECT_TRUE(c,
+		ecdh_get_value(n, "QCAVSx", public_x, size_bytes) &&
+		ecdh_get_value(n, "QCAVSy", public_y, size_bytes) &&
+		ecdh_get_value(n, "dIUT", private, size_bytes) &&
+		ecdh_get_value(n, "ZIUT", expect, size_bytes)))
 		return;
 
-	for (i = 0; i < ARRAY_SIZE(derive_key_ecdh); i++) {
-		pt = &derive_key_ecdh[i];
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		ta_crypt_cmd_allocate_operation(c, s, &op,
+			pt->algo,
+			TEE_MODE_DERIVE, pt->keysize)))
+		return;
 
-		if (pt->level > level)
-			continue;
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		ta_crypt_cmd_allocate_transient_object(c, s,
+			TEE_TYPE_ECDH_KEYPAIR, pt->keysize,
+			&key_handle)))
+		return;
 
-		Do_ADBG_BeginSubCase(c, "Derive ECDH key - algo = 0x%x",
-				     pt->algo);
-		size_bytes = (pt->keysize + 7) / 8;
-		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-			ta_crypt_cmd_allocate_operation(c, &session, &op,
-				pt->algo,
-				TEE_MODE_DERIVE, pt->keysize)))
-			goto out;
+	param_count = 0;
+	xtest_add_attr_value(&param_count, params,
+			     TEE_ATTR_ECC_CURVE, pt->curve, 0);
+	xtest_add_attr(&param_count, params,
+		       TEE_ATTR_ECC_PRIVATE_VALUE,
+		       private, size_bytes);
+	/*
+	 * The public value is not used. This is why we provide
+	 * another buffer
+	 */
+	xtest_add_attr(&param_count, params,
+			TEE_ATTR_ECC_PUBLIC_VALUE_X,
+		       private, size_bytes);
+	xtest_add_attr(&param_count, params,
+			TEE_ATTR_ECC_PUBLIC_VALUE_Y,
+		       private, size_bytes);
 
-		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-			ta_crypt_cmd_allocate_transient_object(c, & session,
-				TEE_TYPE_ECDH_KEYPAIR, pt->keysize,
-				&key_handle)))
-			goto out;
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+			ta_crypt_cmd_populate_transient_object(c, s,
+				key_handle, params, param_count)))
+		return;
 
-		param_count = 0;
-		xtest_add_attr_value(&param_count, params,
-				     TEE_ATTR_ECC_CURVE, pt->curve, 0);
-		xtest_add_attr(&param_count, params,
-			       TEE_ATTR_ECC_PRIVATE_VALUE,
-			       pt->private, size_bytes);
-		/*
-		 * The public value is not used. This is why we provide
-		 * another buffer
-		 */
-		xtest_add_attr(&param_count, params,
-				TEE_ATTR_ECC_PUBLIC_VALUE_X,
-			       pt->private, size_bytes);
-		xtest_add_attr(&param_count, params,
-				TEE_ATTR_ECC_PUBLIC_VALUE_Y,
-			       pt->private, size_bytes);
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+			ta_crypt_cmd_set_operation_key(c, s, op,
+				key_handle)))
+		return;
 
-		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_populate_transient_object(c,
-					&session,
-					key_handle, params, param_count)))
-			goto out;
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+			ta_crypt_cmd_free_transient_object(c, s,
+				key_handle)))
+		return;
 
-		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_set_operation_key(c, &session, op,
-					key_handle)))
-			goto out;
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		ta_crypt_cmd_allocate_transient_object(c, s,
+			TEE_TYPE_GENERIC_SECRET, size_bytes * 8,
+			&sv_handle)))
+		return;
 
-		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-				ta_crypt_cmd_free_transient_object(c, & session,
-					key_handle)))
-			goto out;
+	/* reuse but reset params and param-count */
+	param_count = 0;
 
-		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-			ta_crypt_cmd_allocate_transient_object(c, &session,
-				TEE_TYPE_GENERIC_SECRET, size_bytes * 8,
-				&sv_handle)))
-			goto out;
+	xtest_add_attr(&param_count, params,
+		       TEE_ATTR_ECC_PUBLIC_VALUE_X,
+		       public_x, size_bytes);
+	xtest_add_attr(&param_count, params,
+		       TEE_ATTR_ECC_PUBLIC_VALUE_Y,
+		       public_y, size_bytes);
 
-		/* reuse but reset params and param-count */
-		param_count = 0;
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		ta_crypt_cmd_derive_key(c, s, op, sv_handle,
+				        params, param_count)))
+		return;
 
-		xtest_add_attr(&param_count, params,
-			       TEE_ATTR_ECC_PUBLIC_VALUE_X,
-			       pt->public_x, size_bytes);
-		xtest_add_attr(&param_count, params,
-			       TEE_ATTR_ECC_PUBLIC_VALUE_Y,
-			       pt->public_y, size_bytes);
+	out_size = sizeof(out);
+	memset(out, 0, sizeof(out));
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		ta_crypt_cmd_get_object_buffer_attribute(c, s,
+			sv_handle,
+			TEE_ATTR_SECRET_VALUE, out, &out_size)))
+		return;
 
-		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-			ta_crypt_cmd_derive_key(c, &session, op, sv_handle,
-					        params, param_count)))
-			goto out;
+	if (!ADBG_EXPECT_BUFFER(c, expect, size_bytes,
+				out, out_size))
+		return;
 
-		out_size = sizeof(out);
-		memset(out, 0, sizeof(out));
-		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-			ta_crypt_cmd_get_object_buffer_attribute(c, &session,
-				sv_handle,
-				TEE_ATTR_SECRET_VALUE, out, &out_size)))
-			goto out;
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		ta_crypt_cmd_free_operation(c, s, op)))
+		return;
 
-		if (!ADBG_EXPECT_BUFFER(c, pt->out, size_bytes,
-					out, out_size))
-			goto out;
+	(void)ADBG_EXPECT_TEEC_SUCCESS(c,
+		ta_crypt_cmd_free_transient_object(c, s, sv_handle));
+}
 
-		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-			ta_crypt_cmd_free_operation(c, &session, op)))
-			goto out;
+static const struct xtest_vector_ops ecdh_vector_ops = {
+	.title = ecdh_title,
+	.run = ecdh_run_vector,
+};
 
-		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-			ta_crypt_cmd_free_transient_object(c, &session,
-							   sv_handle)))
-			goto out;
+static void xtest_tee_test_4009(ADBG_Case_t *c)
+{
+	struct xtest_vector_ops ops = ecdh_vector_ops;
 
-		Do_ADBG_EndSubCase(c, "Derive ECDH key - algo = 0x%x",
-				   pt->algo);
+	if (!xtest_rsp_available(ECDH_RSP_FILE)) {
+		Do_ADBG_Log("%s/%s not installed, skipping the ECDH vectors",
+			    xtest_vector_dir, ECDH_RSP_FILE);
+		return;
 	}
 
-	goto noerror;
-
-out:
-	Do_ADBG_EndSubCase(c, "Derive ECDH key - algo = 0x%x", pt->algo);
+	/* Only mapped when the case runs, filtered out cases never read it */
+	if (!ADBG_EXPECT_TRUE(c, xtest_rsp_open(&ecdh_rsp, ECDH_RSP_FILE)))
+		return;
 
-noerror:
-	TEEC_CloseSession(&session);
+	ops.num_vectors = ecdh_rsp.num_vects;
+	xtest_run_vectors(c, &crypt_user_ta_uuid, &ops);
+	xtest_rsp_close(&ecdh_rsp);
 }
 
 static void xtest_tee_test_4010(ADBG_Case_t *c)
@@ -5011,8 +5081,8 @@ static void xtest_tee_test_4010(ADBG_Case_t *c)
 	};
 
 	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
-		xtest_teec_open_session(&session, &crypt_user_ta_uuid, NULL,
-					&ret_orig)))
+		xtest_teec_lease_session(c, &session, &crypt_user_ta_uuid,
+					 &ret_orig)))
 		return;
 
 	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
@@ -5025,5 +5095,5 @@ static void xtest_tee_test_4010(ADBG_Case_t *c)
 						       &attr, 1));
 
 out:
-	TEEC_CloseSession(&session);
+	xtest_teec_release_session(c, &session);
 }
@@ -14,8 +14,6 @@
 #ifndef XTEST_4000_DATA_H
 #define XTEST_4000_DATA_H
 #include <stdint.h>
-#include <nist/186-3dsatestvectors.h>
-#include <nist/ecccdhtestvectors.h>
 
 /*
  * XTS-AES Test data from:
@@ -5969,1281 +5967,4 @@ static const uint8_t derive_key_dh_shared_secret[] = {
 
 static const uint32_t derive_key_max_keysize = 1024;
 
-static struct derive_key_ecdh_t {
-	uint32_t level;		/* test suite level */
-	uint32_t algo;		/* TEE_ALG_ECDH_P192,... */
-	uint32_t curve;		/* TEE_ECC_CURVE_NIST_P192,... */
-	uint32_t keysize;	/* key size, in bits */
-	const uint8_t *public_x;	/* public key - x == QCAVSx */
-	const uint8_t *public_y;	/* public key - y == QCAVSy */
-	const uint8_t *private;	/* private key == dIUT */
-	const uint8_t *out;		/* expected result - ZIUT */
-} derive_key_ecdh[] = {
-	/* [P-192] */
-	{
-		.level    = 0,
-		.algo     = TEE_ALG_ECDH_P192,
-		.curve    = TEE_ECC_CURVE_NIST_P192,
-		.keysize  = 192,
-		.public_x = nist_kas_ecc_cdh_testvector_1_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_1_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_1_private,
-		.out      = nist_kas_ecc_cdh_testvector_1_out,
-	},
-	{
-		.level    = 1,
-		.algo     = TEE_ALG_ECDH_P192,
-		.curve    = TEE_ECC_CURVE_NIST_P192,
-		.keysize  = 192,
-		.public_x = nist_kas_ecc_cdh_testvector_2_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_2_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_2_private,
-		.out      = nist_kas_ecc_cdh_testvector_2_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P192,
-		.curve    = TEE_ECC_CURVE_NIST_P192,
-		.keysize  = 192,
-		.public_x = nist_kas_ecc_cdh_testvector_3_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_3_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_3_private,
-		.out      = nist_kas_ecc_cdh_testvector_3_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P192,
-		.curve    = TEE_ECC_CURVE_NIST_P192,
-		.keysize  = 192,
-		.public_x = nist_kas_ecc_cdh_testvector_4_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_4_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_4_private,
-		.out      = nist_kas_ecc_cdh_testvector_4_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P192,
-		.curve    = TEE_ECC_CURVE_NIST_P192,
-		.keysize  = 192,
-		.public_x = nist_kas_ecc_cdh_testvector_5_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_5_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_5_private,
-		.out      = nist_kas_ecc_cdh_testvector_5_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P192,
-		.curve    = TEE_ECC_CURVE_NIST_P192,
-		.keysize  = 192,
-		.public_x = nist_kas_ecc_cdh_testvector_6_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_6_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_6_private,
-		.out      = nist_kas_ecc_cdh_testvector_6_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P192,
-		.curve    = TEE_ECC_CURVE_NIST_P192,
-		.keysize  = 192,
-		.public_x = nist_kas_ecc_cdh_testvector_7_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_7_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_7_private,
-		.out      = nist_kas_ecc_cdh_testvector_7_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P192,
-		.curve    = TEE_ECC_CURVE_NIST_P192,
-		.keysize  = 192,
-		.public_x = nist_kas_ecc_cdh_testvector_8_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_8_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_8_private,
-		.out      = nist_kas_ecc_cdh_testvector_8_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P192,
-		.curve    = TEE_ECC_CURVE_NIST_P192,
-		.keysize  = 192,
-		.public_x = nist_kas_ecc_cdh_testvector_9_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_9_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_9_private,
-		.out      = nist_kas_ecc_cdh_testvector_9_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P192,
-		.curve    = TEE_ECC_CURVE_NIST_P192,
-		.keysize  = 192,
-		.public_x = nist_kas_ecc_cdh_testvector_10_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_10_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_10_private,
-		.out      = nist_kas_ecc_cdh_testvector_10_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P192,
-		.curve    = TEE_ECC_CURVE_NIST_P192,
-		.keysize  = 192,
-		.public_x = nist_kas_ecc_cdh_testvector_11_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_11_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_11_private,
-		.out      = nist_kas_ecc_cdh_testvector_11_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P192,
-		.curve    = TEE_ECC_CURVE_NIST_P192,
-		.keysize  = 192,
-		.public_x = nist_kas_ecc_cdh_testvector_12_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_12_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_12_private,
-		.out      = nist_kas_ecc_cdh_testvector_12_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P192,
-		.curve    = TEE_ECC_CURVE_NIST_P192,
-		.keysize  = 192,
-		.public_x = nist_kas_ecc_cdh_testvector_13_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_13_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_13_private,
-		.out      = nist_kas_ecc_cdh_testvector_13_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P192,
-		.curve    = TEE_ECC_CURVE_NIST_P192,
-		.keysize  = 192,
-		.public_x = nist_kas_ecc_cdh_testvector_14_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_14_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_14_private,
-		.out      = nist_kas_ecc_cdh_testvector_14_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P192,
-		.curve    = TEE_ECC_CURVE_NIST_P192,
-		.keysize  = 192,
-		.public_x = nist_kas_ecc_cdh_testvector_15_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_15_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_15_private,
-		.out      = nist_kas_ecc_cdh_testvector_15_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P192,
-		.curve    = TEE_ECC_CURVE_NIST_P192,
-		.keysize  = 192,
-		.public_x = nist_kas_ecc_cdh_testvector_16_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_16_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_16_private,
-		.out      = nist_kas_ecc_cdh_testvector_16_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P192,
-		.curve    = TEE_ECC_CURVE_NIST_P192,
-		.keysize  = 192,
-		.public_x = nist_kas_ecc_cdh_testvector_17_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_17_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_17_private,
-		.out      = nist_kas_ecc_cdh_testvector_17_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P192,
-		.curve    = TEE_ECC_CURVE_NIST_P192,
-		.keysize  = 192,
-		.public_x = nist_kas_ecc_cdh_testvector_18_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_18_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_18_private,
-		.out      = nist_kas_ecc_cdh_testvector_18_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P192,
-		.curve    = TEE_ECC_CURVE_NIST_P192,
-		.keysize  = 192,
-		.public_x = nist_kas_ecc_cdh_testvector_19_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_19_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_19_private,
-		.out      = nist_kas_ecc_cdh_testvector_19_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P192,
-		.curve    = TEE_ECC_CURVE_NIST_P192,
-		.keysize  = 192,
-		.public_x = nist_kas_ecc_cdh_testvector_20_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_20_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_20_private,
-		.out      = nist_kas_ecc_cdh_testvector_20_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P192,
-		.curve    = TEE_ECC_CURVE_NIST_P192,
-		.keysize  = 192,
-		.public_x = nist_kas_ecc_cdh_testvector_21_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_21_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_21_private,
-		.out      = nist_kas_ecc_cdh_testvector_21_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P192,
-		.curve    = TEE_ECC_CURVE_NIST_P192,
-		.keysize  = 192,
-		.public_x = nist_kas_ecc_cdh_testvector_22_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_22_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_22_private,
-		.out      = nist_kas_ecc_cdh_testvector_22_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P192,
-		.curve    = TEE_ECC_CURVE_NIST_P192,
-		.keysize  = 192,
-		.public_x = nist_kas_ecc_cdh_testvector_23_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_23_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_23_private,
-		.out      = nist_kas_ecc_cdh_testvector_23_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P192,
-		.curve    = TEE_ECC_CURVE_NIST_P192,
-		.keysize  = 192,
-		.public_x = nist_kas_ecc_cdh_testvector_24_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_24_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_24_private,
-		.out      = nist_kas_ecc_cdh_testvector_24_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P192,
-		.curve    = TEE_ECC_CURVE_NIST_P192,
-		.keysize  = 192,
-		.public_x = nist_kas_ecc_cdh_testvector_25_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_25_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_25_private,
-		.out      = nist_kas_ecc_cdh_testvector_25_out,
-	},
-	/* [P-224] */
-	{
-		.level    = 0,
-		.algo     = TEE_ALG_ECDH_P224,
-		.curve    = TEE_ECC_CURVE_NIST_P224,
-		.keysize  = 224,
-		.public_x = nist_kas_ecc_cdh_testvector_26_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_26_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_26_private,
-		.out      = nist_kas_ecc_cdh_testvector_26_out,
-	},
-	{
-		.level    = 1,
-		.algo     = TEE_ALG_ECDH_P224,
-		.curve    = TEE_ECC_CURVE_NIST_P224,
-		.keysize  = 224,
-		.public_x = nist_kas_ecc_cdh_testvector_27_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_27_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_27_private,
-		.out      = nist_kas_ecc_cdh_testvector_27_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P224,
-		.curve    = TEE_ECC_CURVE_NIST_P224,
-		.keysize  = 224,
-		.public_x = nist_kas_ecc_cdh_testvector_28_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_28_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_28_private,
-		.out      = nist_kas_ecc_cdh_testvector_28_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P224,
-		.curve    = TEE_ECC_CURVE_NIST_P224,
-		.keysize  = 224,
-		.public_x = nist_kas_ecc_cdh_testvector_29_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_29_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_29_private,
-		.out      = nist_kas_ecc_cdh_testvector_29_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P224,
-		.curve    = TEE_ECC_CURVE_NIST_P224,
-		.keysize  = 224,
-		.public_x = nist_kas_ecc_cdh_testvector_30_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_30_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_30_private,
-		.out      = nist_kas_ecc_cdh_testvector_30_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P224,
-		.curve    = TEE_ECC_CURVE_NIST_P224,
-		.keysize  = 224,
-		.public_x = nist_kas_ecc_cdh_testvector_31_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_31_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_31_private,
-		.out      = nist_kas_ecc_cdh_testvector_31_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P224,
-		.curve    = TEE_ECC_CURVE_NIST_P224,
-		.keysize  = 224,
-		.public_x = nist_kas_ecc_cdh_testvector_32_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_32_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_32_private,
-		.out      = nist_kas_ecc_cdh_testvector_32_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P224,
-		.curve    = TEE_ECC_CURVE_NIST_P224,
-		.keysize  = 224,
-		.public_x = nist_kas_ecc_cdh_testvector_33_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_33_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_33_private,
-		.out      = nist_kas_ecc_cdh_testvector_33_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P224,
-		.curve    = TEE_ECC_CURVE_NIST_P224,
-		.keysize  = 224,
-		.public_x = nist_kas_ecc_cdh_testvector_34_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_34_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_34_private,
-		.out      = nist_kas_ecc_cdh_testvector_34_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P224,
-		.curve    = TEE_ECC_CURVE_NIST_P224,
-		.keysize  = 224,
-		.public_x = nist_kas_ecc_cdh_testvector_35_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_35_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_35_private,
-		.out      = nist_kas_ecc_cdh_testvector_35_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P224,
-		.curve    = TEE_ECC_CURVE_NIST_P224,
-		.keysize  = 224,
-		.public_x = nist_kas_ecc_cdh_testvector_36_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_36_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_36_private,
-		.out      = nist_kas_ecc_cdh_testvector_36_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P224,
-		.curve    = TEE_ECC_CURVE_NIST_P224,
-		.keysize  = 224,
-		.public_x = nist_kas_ecc_cdh_testvector_37_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_37_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_37_private,
-		.out      = nist_kas_ecc_cdh_testvector_37_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P224,
-		.curve    = TEE_ECC_CURVE_NIST_P224,
-		.keysize  = 224,
-		.public_x = nist_kas_ecc_cdh_testvector_38_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_38_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_38_private,
-		.out      = nist_kas_ecc_cdh_testvector_38_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P224,
-		.curve    = TEE_ECC_CURVE_NIST_P224,
-		.keysize  = 224,
-		.public_x = nist_kas_ecc_cdh_testvector_39_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_39_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_39_private,
-		.out      = nist_kas_ecc_cdh_testvector_39_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P224,
-		.curve    = TEE_ECC_CURVE_NIST_P224,
-		.keysize  = 224,
-		.public_x = nist_kas_ecc_cdh_testvector_40_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_40_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_40_private,
-		.out      = nist_kas_ecc_cdh_testvector_40_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P224,
-		.curve    = TEE_ECC_CURVE_NIST_P224,
-		.keysize  = 224,
-		.public_x = nist_kas_ecc_cdh_testvector_41_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_41_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_41_private,
-		.out      = nist_kas_ecc_cdh_testvector_41_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P224,
-		.curve    = TEE_ECC_CURVE_NIST_P224,
-		.keysize  = 224,
-		.public_x = nist_kas_ecc_cdh_testvector_42_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_42_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_42_private,
-		.out      = nist_kas_ecc_cdh_testvector_42_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P224,
-		.curve    = TEE_ECC_CURVE_NIST_P224,
-		.keysize  = 224,
-		.public_x = nist_kas_ecc_cdh_testvector_43_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_43_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_43_private,
-		.out      = nist_kas_ecc_cdh_testvector_43_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P224,
-		.curve    = TEE_ECC_CURVE_NIST_P224,
-		.keysize  = 224,
-		.public_x = nist_kas_ecc_cdh_testvector_44_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_44_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_44_private,
-		.out      = nist_kas_ecc_cdh_testvector_44_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P224,
-		.curve    = TEE_ECC_CURVE_NIST_P224,
-		.keysize  = 224,
-		.public_x = nist_kas_ecc_cdh_testvector_45_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_45_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_45_private,
-		.out      = nist_kas_ecc_cdh_testvector_45_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P224,
-		.curve    = TEE_ECC_CURVE_NIST_P224,
-		.keysize  = 224,
-		.public_x = nist_kas_ecc_cdh_testvector_46_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_46_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_46_private,
-		.out      = nist_kas_ecc_cdh_testvector_46_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P224,
-		.curve    = TEE_ECC_CURVE_NIST_P224,
-		.keysize  = 224,
-		.public_x = nist_kas_ecc_cdh_testvector_47_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_47_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_47_private,
-		.out      = nist_kas_ecc_cdh_testvector_47_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P224,
-		.curve    = TEE_ECC_CURVE_NIST_P224,
-		.keysize  = 224,
-		.public_x = nist_kas_ecc_cdh_testvector_48_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_48_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_48_private,
-		.out      = nist_kas_ecc_cdh_testvector_48_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P224,
-		.curve    = TEE_ECC_CURVE_NIST_P224,
-		.keysize  = 224,
-		.public_x = nist_kas_ecc_cdh_testvector_49_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_49_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_49_private,
-		.out      = nist_kas_ecc_cdh_testvector_49_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P224,
-		.curve    = TEE_ECC_CURVE_NIST_P224,
-		.keysize  = 224,
-		.public_x = nist_kas_ecc_cdh_testvector_50_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_50_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_50_private,
-		.out      = nist_kas_ecc_cdh_testvector_50_out,
-	},
-	/* [P-256] */
-	{
-		.level    = 0,
-		.algo     = TEE_ALG_ECDH_P256,
-		.curve    = TEE_ECC_CURVE_NIST_P256,
-		.keysize  = 256,
-		.public_x = nist_kas_ecc_cdh_testvector_51_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_51_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_51_private,
-		.out      = nist_kas_ecc_cdh_testvector_51_out,
-	},
-	{
-		.level    = 1,
-		.algo     = TEE_ALG_ECDH_P256,
-		.curve    = TEE_ECC_CURVE_NIST_P256,
-		.keysize  = 256,
-		.public_x = nist_kas_ecc_cdh_testvector_52_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_52_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_52_private,
-		.out      = nist_kas_ecc_cdh_testvector_52_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P256,
-		.curve    = TEE_ECC_CURVE_NIST_P256,
-		.keysize  = 256,
-		.public_x = nist_kas_ecc_cdh_testvector_53_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_53_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_53_private,
-		.out      = nist_kas_ecc_cdh_testvector_53_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P256,
-		.curve    = TEE_ECC_CURVE_NIST_P256,
-		.keysize  = 256,
-		.public_x = nist_kas_ecc_cdh_testvector_54_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_54_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_54_private,
-		.out      = nist_kas_ecc_cdh_testvector_54_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P256,
-		.curve    = TEE_ECC_CURVE_NIST_P256,
-		.keysize  = 256,
-		.public_x = nist_kas_ecc_cdh_testvector_55_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_55_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_55_private,
-		.out      = nist_kas_ecc_cdh_testvector_55_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P256,
-		.curve    = TEE_ECC_CURVE_NIST_P256,
-		.keysize  = 256,
-		.public_x = nist_kas_ecc_cdh_testvector_56_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_56_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_56_private,
-		.out      = nist_kas_ecc_cdh_testvector_56_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P256,
-		.curve    = TEE_ECC_CURVE_NIST_P256,
-		.keysize  = 256,
-		.public_x = nist_kas_ecc_cdh_testvector_57_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_57_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_57_private,
-		.out      = nist_kas_ecc_cdh_testvector_57_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P256,
-		.curve    = TEE_ECC_CURVE_NIST_P256,
-		.keysize  = 256,
-		.public_x = nist_kas_ecc_cdh_testvector_58_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_58_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_58_private,
-		.out      = nist_kas_ecc_cdh_testvector_58_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P256,
-		.curve    = TEE_ECC_CURVE_NIST_P256,
-		.keysize  = 256,
-		.public_x = nist_kas_ecc_cdh_testvector_59_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_59_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_59_private,
-		.out      = nist_kas_ecc_cdh_testvector_59_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P256,
-		.curve    = TEE_ECC_CURVE_NIST_P256,
-		.keysize  = 256,
-		.public_x = nist_kas_ecc_cdh_testvector_60_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_60_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_60_private,
-		.out      = nist_kas_ecc_cdh_testvector_60_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P256,
-		.curve    = TEE_ECC_CURVE_NIST_P256,
-		.keysize  = 256,
-		.public_x = nist_kas_ecc_cdh_testvector_61_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_61_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_61_private,
-		.out      = nist_kas_ecc_cdh_testvector_61_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P256,
-		.curve    = TEE_ECC_CURVE_NIST_P256,
-		.keysize  = 256,
-		.public_x = nist_kas_ecc_cdh_testvector_62_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_62_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_62_private,
-		.out      = nist_kas_ecc_cdh_testvector_62_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P256,
-		.curve    = TEE_ECC_CURVE_NIST_P256,
-		.keysize  = 256,
-		.public_x = nist_kas_ecc_cdh_testvector_63_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_63_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_63_private,
-		.out      = nist_kas_ecc_cdh_testvector_63_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P256,
-		.curve    = TEE_ECC_CURVE_NIST_P256,
-		.keysize  = 256,
-		.public_x = nist_kas_ecc_cdh_testvector_64_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_64_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_64_private,
-		.out      = nist_kas_ecc_cdh_testvector_64_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P256,
-		.curve    = TEE_ECC_CURVE_NIST_P256,
-		.keysize  = 256,
-		.public_x = nist_kas_ecc_cdh_testvector_65_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_65_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_65_private,
-		.out      = nist_kas_ecc_cdh_testvector_65_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P256,
-		.curve    = TEE_ECC_CURVE_NIST_P256,
-		.keysize  = 256,
-		.public_x = nist_kas_ecc_cdh_testvector_66_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_66_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_66_private,
-		.out      = nist_kas_ecc_cdh_testvector_66_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P256,
-		.curve    = TEE_ECC_CURVE_NIST_P256,
-		.keysize  = 256,
-		.public_x = nist_kas_ecc_cdh_testvector_67_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_67_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_67_private,
-		.out      = nist_kas_ecc_cdh_testvector_67_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P256,
-		.curve    = TEE_ECC_CURVE_NIST_P256,
-		.keysize  = 256,
-		.public_x = nist_kas_ecc_cdh_testvector_68_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_68_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_68_private,
-		.out      = nist_kas_ecc_cdh_testvector_68_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P256,
-		.curve    = TEE_ECC_CURVE_NIST_P256,
-		.keysize  = 256,
-		.public_x = nist_kas_ecc_cdh_testvector_69_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_69_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_69_private,
-		.out      = nist_kas_ecc_cdh_testvector_69_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P256,
-		.curve    = TEE_ECC_CURVE_NIST_P256,
-		.keysize  = 256,
-		.public_x = nist_kas_ecc_cdh_testvector_70_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_70_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_70_private,
-		.out      = nist_kas_ecc_cdh_testvector_70_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P256,
-		.curve    = TEE_ECC_CURVE_NIST_P256,
-		.keysize  = 256,
-		.public_x = nist_kas_ecc_cdh_testvector_71_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_71_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_71_private,
-		.out      = nist_kas_ecc_cdh_testvector_71_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P256,
-		.curve    = TEE_ECC_CURVE_NIST_P256,
-		.keysize  = 256,
-		.public_x = nist_kas_ecc_cdh_testvector_72_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_72_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_72_private,
-		.out      = nist_kas_ecc_cdh_testvector_72_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P256,
-		.curve    = TEE_ECC_CURVE_NIST_P256,
-		.keysize  = 256,
-		.public_x = nist_kas_ecc_cdh_testvector_73_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_73_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_73_private,
-		.out      = nist_kas_ecc_cdh_testvector_73_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P256,
-		.curve    = TEE_ECC_CURVE_NIST_P256,
-		.keysize  = 256,
-		.public_x = nist_kas_ecc_cdh_testvector_74_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_74_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_74_private,
-		.out      = nist_kas_ecc_cdh_testvector_74_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P256,
-		.curve    = TEE_ECC_CURVE_NIST_P256,
-		.keysize  = 256,
-		.public_x = nist_kas_ecc_cdh_testvector_75_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_75_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_75_private,
-		.out      = nist_kas_ecc_cdh_testvector_75_out,
-	},
-	/* [P-384] */
-	{
-		.level    = 0,
-		.algo     = TEE_ALG_ECDH_P384,
-		.curve    = TEE_ECC_CURVE_NIST_P384,
-		.keysize  = 384,
-		.public_x = nist_kas_ecc_cdh_testvector_76_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_76_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_76_private,
-		.out      = nist_kas_ecc_cdh_testvector_76_out,
-	},
-	{
-		.level    = 1,
-		.algo     = TEE_ALG_ECDH_P384,
-		.curve    = TEE_ECC_CURVE_NIST_P384,
-		.keysize  = 384,
-		.public_x = nist_kas_ecc_cdh_testvector_77_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_77_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_77_private,
-		.out      = nist_kas_ecc_cdh_testvector_77_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P384,
-		.curve    = TEE_ECC_CURVE_NIST_P384,
-		.keysize  = 384,
-		.public_x = nist_kas_ecc_cdh_testvector_78_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_78_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_78_private,
-		.out      = nist_kas_ecc_cdh_testvector_78_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P384,
-		.curve    = TEE_ECC_CURVE_NIST_P384,
-		.keysize  = 384,
-		.public_x = nist_kas_ecc_cdh_testvector_79_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_79_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_79_private,
-		.out      = nist_kas_ecc_cdh_testvector_79_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P384,
-		.curve    = TEE_ECC_CURVE_NIST_P384,
-		.keysize  = 384,
-		.public_x = nist_kas_ecc_cdh_testvector_80_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_80_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_80_private,
-		.out      = nist_kas_ecc_cdh_testvector_80_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P384,
-		.curve    = TEE_ECC_CURVE_NIST_P384,
-		.keysize  = 384,
-		.public_x = nist_kas_ecc_cdh_testvector_81_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_81_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_81_private,
-		.out      = nist_kas_ecc_cdh_testvector_81_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P384,
-		.curve    = TEE_ECC_CURVE_NIST_P384,
-		.keysize  = 384,
-		.public_x = nist_kas_ecc_cdh_testvector_82_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_82_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_82_private,
-		.out      = nist_kas_ecc_cdh_testvector_82_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P384,
-		.curve    = TEE_ECC_CURVE_NIST_P384,
-		.keysize  = 384,
-		.public_x = nist_kas_ecc_cdh_testvector_83_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_83_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_83_private,
-		.out      = nist_kas_ecc_cdh_testvector_83_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P384,
-		.curve    = TEE_ECC_CURVE_NIST_P384,
-		.keysize  = 384,
-		.public_x = nist_kas_ecc_cdh_testvector_84_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_84_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_84_private,
-		.out      = nist_kas_ecc_cdh_testvector_84_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P384,
-		.curve    = TEE_ECC_CURVE_NIST_P384,
-		.keysize  = 384,
-		.public_x = nist_kas_ecc_cdh_testvector_85_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_85_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_85_private,
-		.out      = nist_kas_ecc_cdh_testvector_85_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P384,
-		.curve    = TEE_ECC_CURVE_NIST_P384,
-		.keysize  = 384,
-		.public_x = nist_kas_ecc_cdh_testvector_86_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_86_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_86_private,
-		.out      = nist_kas_ecc_cdh_testvector_86_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P384,
-		.curve    = TEE_ECC_CURVE_NIST_P384,
-		.keysize  = 384,
-		.public_x = nist_kas_ecc_cdh_testvector_87_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_87_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_87_private,
-		.out      = nist_kas_ecc_cdh_testvector_87_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P384,
-		.curve    = TEE_ECC_CURVE_NIST_P384,
-		.keysize  = 384,
-		.public_x = nist_kas_ecc_cdh_testvector_88_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_88_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_88_private,
-		.out      = nist_kas_ecc_cdh_testvector_88_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P384,
-		.curve    = TEE_ECC_CURVE_NIST_P384,
-		.keysize  = 384,
-		.public_x = nist_kas_ecc_cdh_testvector_89_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_89_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_89_private,
-		.out      = nist_kas_ecc_cdh_testvector_89_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P384,
-		.curve    = TEE_ECC_CURVE_NIST_P384,
-		.keysize  = 384,
-		.public_x = nist_kas_ecc_cdh_testvector_90_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_90_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_90_private,
-		.out      = nist_kas_ecc_cdh_testvector_90_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P384,
-		.curve    = TEE_ECC_CURVE_NIST_P384,
-		.keysize  = 384,
-		.public_x = nist_kas_ecc_cdh_testvector_91_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_91_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_91_private,
-		.out      = nist_kas_ecc_cdh_testvector_91_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P384,
-		.curve    = TEE_ECC_CURVE_NIST_P384,
-		.keysize  = 384,
-		.public_x = nist_kas_ecc_cdh_testvector_92_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_92_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_92_private,
-		.out      = nist_kas_ecc_cdh_testvector_92_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P384,
-		.curve    = TEE_ECC_CURVE_NIST_P384,
-		.keysize  = 384,
-		.public_x = nist_kas_ecc_cdh_testvector_93_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_93_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_93_private,
-		.out      = nist_kas_ecc_cdh_testvector_93_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P384,
-		.curve    = TEE_ECC_CURVE_NIST_P384,
-		.keysize  = 384,
-		.public_x = nist_kas_ecc_cdh_testvector_94_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_94_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_94_private,
-		.out      = nist_kas_ecc_cdh_testvector_94_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P384,
-		.curve    = TEE_ECC_CURVE_NIST_P384,
-		.keysize  = 384,
-		.public_x = nist_kas_ecc_cdh_testvector_95_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_95_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_95_private,
-		.out      = nist_kas_ecc_cdh_testvector_95_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P384,
-		.curve    = TEE_ECC_CURVE_NIST_P384,
-		.keysize  = 384,
-		.public_x = nist_kas_ecc_cdh_testvector_96_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_96_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_96_private,
-		.out      = nist_kas_ecc_cdh_testvector_96_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P384,
-		.curve    = TEE_ECC_CURVE_NIST_P384,
-		.keysize  = 384,
-		.public_x = nist_kas_ecc_cdh_testvector_97_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_97_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_97_private,
-		.out      = nist_kas_ecc_cdh_testvector_97_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P384,
-		.curve    = TEE_ECC_CURVE_NIST_P384,
-		.keysize  = 384,
-		.public_x = nist_kas_ecc_cdh_testvector_98_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_98_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_98_private,
-		.out      = nist_kas_ecc_cdh_testvector_98_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P384,
-		.curve    = TEE_ECC_CURVE_NIST_P384,
-		.keysize  = 384,
-		.public_x = nist_kas_ecc_cdh_testvector_99_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_99_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_99_private,
-		.out      = nist_kas_ecc_cdh_testvector_99_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P384,
-		.curve    = TEE_ECC_CURVE_NIST_P384,
-		.keysize  = 384,
-		.public_x = nist_kas_ecc_cdh_testvector_100_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_100_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_100_private,
-		.out      = nist_kas_ecc_cdh_testvector_100_out,
-	},
-	/* [P-521] */
-	{
-		.level    = 0,
-		.algo     = TEE_ALG_ECDH_P521,
-		.curve    = TEE_ECC_CURVE_NIST_P521,
-		.keysize  = 521,
-		.public_x = nist_kas_ecc_cdh_testvector_101_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_101_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_101_private,
-		.out      = nist_kas_ecc_cdh_testvector_101_out,
-	},
-	{
-		.level    = 1,
-		.algo     = TEE_ALG_ECDH_P521,
-		.curve    = TEE_ECC_CURVE_NIST_P521,
-		.keysize  = 521,
-		.public_x = nist_kas_ecc_cdh_testvector_102_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_102_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_102_private,
-		.out      = nist_kas_ecc_cdh_testvector_102_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P521,
-		.curve    = TEE_ECC_CURVE_NIST_P521,
-		.keysize  = 521,
-		.public_x = nist_kas_ecc_cdh_testvector_103_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_103_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_103_private,
-		.out      = nist_kas_ecc_cdh_testvector_103_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P521,
-		.curve    = TEE_ECC_CURVE_NIST_P521,
-		.keysize  = 521,
-		.public_x = nist_kas_ecc_cdh_testvector_104_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_104_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_104_private,
-		.out      = nist_kas_ecc_cdh_testvector_104_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P521,
-		.curve    = TEE_ECC_CURVE_NIST_P521,
-		.keysize  = 521,
-		.public_x = nist_kas_ecc_cdh_testvector_105_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_105_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_105_private,
-		.out      = nist_kas_ecc_cdh_testvector_105_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P521,
-		.curve    = TEE_ECC_CURVE_NIST_P521,
-		.keysize  = 521,
-		.public_x = nist_kas_ecc_cdh_testvector_106_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_106_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_106_private,
-		.out      = nist_kas_ecc_cdh_testvector_106_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P521,
-		.curve    = TEE_ECC_CURVE_NIST_P521,
-		.keysize  = 521,
-		.public_x = nist_kas_ecc_cdh_testvector_107_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_107_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_107_private,
-		.out      = nist_kas_ecc_cdh_testvector_107_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P521,
-		.curve    = TEE_ECC_CURVE_NIST_P521,
-		.keysize  = 521,
-		.public_x = nist_kas_ecc_cdh_testvector_108_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_108_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_108_private,
-		.out      = nist_kas_ecc_cdh_testvector_108_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P521,
-		.curve    = TEE_ECC_CURVE_NIST_P521,
-		.keysize  = 521,
-		.public_x = nist_kas_ecc_cdh_testvector_109_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_109_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_109_private,
-		.out      = nist_kas_ecc_cdh_testvector_109_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P521,
-		.curve    = TEE_ECC_CURVE_NIST_P521,
-		.keysize  = 521,
-		.public_x = nist_kas_ecc_cdh_testvector_110_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_110_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_110_private,
-		.out      = nist_kas_ecc_cdh_testvector_110_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P521,
-		.curve    = TEE_ECC_CURVE_NIST_P521,
-		.keysize  = 521,
-		.public_x = nist_kas_ecc_cdh_testvector_111_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_111_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_111_private,
-		.out      = nist_kas_ecc_cdh_testvector_111_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P521,
-		.curve    = TEE_ECC_CURVE_NIST_P521,
-		.keysize  = 521,
-		.public_x = nist_kas_ecc_cdh_testvector_112_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_112_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_112_private,
-		.out      = nist_kas_ecc_cdh_testvector_112_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P521,
-		.curve    = TEE_ECC_CURVE_NIST_P521,
-		.keysize  = 521,
-		.public_x = nist_kas_ecc_cdh_testvector_113_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_113_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_113_private,
-		.out      = nist_kas_ecc_cdh_testvector_113_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P521,
-		.curve    = TEE_ECC_CURVE_NIST_P521,
-		.keysize  = 521,
-		.public_x = nist_kas_ecc_cdh_testvector_114_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_114_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_114_private,
-		.out      = nist_kas_ecc_cdh_testvector_114_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P521,
-		.curve    = TEE_ECC_CURVE_NIST_P521,
-		.keysize  = 521,
-		.public_x = nist_kas_ecc_cdh_testvector_115_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_115_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_115_private,
-		.out      = nist_kas_ecc_cdh_testvector_115_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P521,
-		.curve    = TEE_ECC_CURVE_NIST_P521,
-		.keysize  = 521,
-		.public_x = nist_kas_ecc_cdh_testvector_116_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_116_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_116_private,
-		.out      = nist_kas_ecc_cdh_testvector_116_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P521,
-		.curve    = TEE_ECC_CURVE_NIST_P521,
-		.keysize  = 521,
-		.public_x = nist_kas_ecc_cdh_testvector_117_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_117_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_117_private,
-		.out      = nist_kas_ecc_cdh_testvector_117_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P521,
-		.curve    = TEE_ECC_CURVE_NIST_P521,
-		.keysize  = 521,
-		.public_x = nist_kas_ecc_cdh_testvector_118_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_118_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_118_private,
-		.out      = nist_kas_ecc_cdh_testvector_118_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P521,
-		.curve    = TEE_ECC_CURVE_NIST_P521,
-		.keysize  = 521,
-		.public_x = nist_kas_ecc_cdh_testvector_119_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_119_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_119_private,
-		.out      = nist_kas_ecc_cdh_testvector_119_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P521,
-		.curve    = TEE_ECC_CURVE_NIST_P521,
-		.keysize  = 521,
-		.public_x = nist_kas_ecc_cdh_testvector_120_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_120_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_120_private,
-		.out      = nist_kas_ecc_cdh_testvector_120_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P521,
-		.curve    = TEE_ECC_CURVE_NIST_P521,
-		.keysize  = 521,
-		.public_x = nist_kas_ecc_cdh_testvector_121_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_121_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_121_private,
-		.out      = nist_kas_ecc_cdh_testvector_121_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P521,
-		.curve    = TEE_ECC_CURVE_NIST_P521,
-		.keysize  = 521,
-		.public_x = nist_kas_ecc_cdh_testvector_122_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_122_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_122_private,
-		.out      = nist_kas_ecc_cdh_testvector_122_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P521,
-		.curve    = TEE_ECC_CURVE_NIST_P521,
-		.keysize  = 521,
-		.public_x = nist_kas_ecc_cdh_testvector_123_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_123_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_123_private,
-		.out      = nist_kas_ecc_cdh_testvector_123_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P521,
-		.curve    = TEE_ECC_CURVE_NIST_P521,
-		.keysize  = 521,
-		.public_x = nist_kas_ecc_cdh_testvector_124_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_124_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_124_private,
-		.out      = nist_kas_ecc_cdh_testvector_124_out,
-	},
-	{
-		.level    = 15,
-		.algo     = TEE_ALG_ECDH_P521,
-		.curve    = TEE_ECC_CURVE_NIST_P521,
-		.keysize  = 521,
-		.public_x = nist_kas_ecc_cdh_testvector_125_public_x,
-		.public_y = nist_kas_ecc_cdh_testvector_125_public_y,
-		.private  = nist_kas_ecc_cdh_testvector_125_private,
-		.out      = nist_kas_ecc_cdh_testvector_125_out,
-	},
-	/* [K-163] - GP NOT SUPPORTED */
-	/* [K-233] - GP NOT SUPPORTED */
-	/* [K-283] - GP NOT SUPPORTED */
-	/* [K-409] - GP NOT SUPPORTED */
-	/* [K-571] - GP NOT SUPPORTED */
-	/* [B-163] - GP NOT SUPPORTED */
-	/* [B-233] - GP NOT SUPPORTED */
-	/* [B-283] - GP NOT SUPPORTED */
-	/* [B-409] - GP NOT SUPPORTED */
-	/* [B-571] - GP NOT SUPPORTED */
-};
-
 #endif /*XTEST_4000_DATA_H*/
@@ -0,0 +1,1340 @@
+/*
+ * Copyright (c) 2015, Linaro Limited
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License Version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ */
+
+#include <ctype.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "xtest_test.h"
+#include "xtest_helpers.h"
+#include "xtest_cipher_stream.h"
+
+#include <ta_crypt.h>
+#include <tee_api_types.h>
+#include <utee_defines.h>
+#include <util.h>
+
+/*
+ * Each measurement processes roughly BENCH_TOTAL_SIZE bytes, but never
+ * less than BENCH_MIN_LOOPS nor more than BENCH_MAX_LOOPS invocations.
+ */
+#define BENCH_TOTAL_SIZE (4 * 1024 * 1024) /* 4MB */
+#define BENCH_MIN_LOOPS 16
+#define BENCH_MAX_LOOPS 4096
+
+static const size_t crypt_data_size_table[] = {
+	16,
+	64,
+	256,
+	1024,
+	4 * 1024,
+	16 * 1024,
+	64 * 1024,
+	256 * 1024,
+	1024 * 1024,
+	0
+};
+
+struct aes_impl_record {
+	uint32_t impl;
+	const char *name;
+};
+
+static const struct aes_impl_record aes_impls[] = {
+	{ TA_CRYPT_AES_IMPL_SINGLE_BLOCK, "single" },
+	{ TA_CRYPT_AES_IMPL_MULTI_BLOCK, "multi" },
+	{ TA_CRYPT_AES_IMPL_ARMV8_CE, "armv8-ce" },
+};
+
+static const char * const sha256_impl_names[TA_CRYPT_SHA256_IMPL_COUNT] = {
+	[TA_CRYPT_SHA256_IMPL_ROLLED] = "rolled",
+	[TA_CRYPT_SHA256_IMPL_UNROLLED] = "unrolled",
+	[TA_CRYPT_SHA256_IMPL_ARMV8_CE] = "armv8-ce",
+};
+
+/* Timing is done in the TA with millisecond resolution */
+#define SHA256_BENCH_TOTAL_SIZE (32 * 1024 * 1024) /* 32MB */
+
+static void xtest_tee_benchmark_2001(ADBG_Case_t *Case_p);
+static void xtest_tee_benchmark_2002(ADBG_Case_t *Case_p);
+static void xtest_tee_benchmark_2003(ADBG_Case_t *Case_p);
+static void xtest_tee_benchmark_2004(ADBG_Case_t *Case_p);
+static void xtest_tee_benchmark_2005(ADBG_Case_t *Case_p);
+static void xtest_tee_benchmark_2006(ADBG_Case_t *Case_p);
+static void xtest_tee_benchmark_2007(ADBG_Case_t *Case_p);
+
+static uint64_t bench_now_us(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static size_t bench_loops(size_t data_size)
+{
+	size_t loops = BENCH_TOTAL_SIZE / data_size;
+
+	if (loops < BENCH_MIN_LOOPS)
+		return BENCH_MIN_LOOPS;
+	if (loops > BENCH_MAX_LOOPS)
+		return BENCH_MAX_LOOPS;
+	return loops;
+}
+
+static float bench_speed_in_kb(size_t data_size, size_t loops, uint64_t us)
+{
+	if (!us)
+		us = 1;
+	return ((float)data_size * loops / 1024.0) / ((float)us / 1000000.0);
+}
+
+static TEEC_Result aes_ecb_invoke(TEEC_Session *s, uint32_t cmd,
+				  uint32_t impl, TEEC_SharedMemory *in,
+				  TEEC_SharedMemory *out, size_t size)
+{
+	TEEC_Operation op = TEEC_OPERATION_INITIALIZER;
+	uint32_t ret_orig;
+
+	op.params[0].memref.parent = in;
+	op.params[0].memref.offset = 0;
+	op.params[0].memref.size = size;
+	op.params[1].memref.parent = out;
+	op.params[1].memref.offset = 0;
+	op.params[1].memref.size = size;
+	op.params[2].value.a = impl;
+	op.paramTypes = TEEC_PARAM_TYPES(TEEC_MEMREF_PARTIAL_INPUT,
+					 TEEC_MEMREF_PARTIAL_OUTPUT,
+					 TEEC_VALUE_INPUT, TEEC_NONE);
+
+	return TEEC_InvokeCommand(s, cmd, &op, &ret_orig);
+}
+
+static void aes_ecb_print_sep(void)
+{
+	size_t i;
+
+	printf("-----------------");
+	for (i = 0; i < ARRAY_SIZE(aes_impls); i++)
+		printf("+---------------------");
+	printf("\n");
+}
+
+static void aes_ecb_print_header(void)
+{
+	size_t i;
+
+	aes_ecb_print_sep();
+	printf(" Data Size (B) \t ");
+	for (i = 0; i < ARRAY_SIZE(aes_impls); i++)
+		printf("| %-8s kB/s (x)   ", aes_impls[i].name);
+	printf("\n");
+	aes_ecb_print_sep();
+}
+
+static void aes_ecb_bench(ADBG_Case_t *c, TEEC_Session *s, uint32_t cmd)
+{
+	size_t max_size = 1024 * 1024;
+	TEEC_SharedMemory in = { 0 };
+	TEEC_SharedMemory out = { 0 };
+	uint8_t *ref = NULL;
+	bool avail[ARRAY_SIZE(aes_impls)];
+	TEEC_Result res;
+	size_t n;
+	size_t i;
+	size_t l;
+
+	in.size = max_size;
+	in.flags = TEEC_MEM_INPUT;
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		TEEC_AllocateSharedMemory(&xtest_teec_ctx, &in)))
+		return;
+
+	out.size = max_size;
+	out.flags = TEEC_MEM_OUTPUT;
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		TEEC_AllocateSharedMemory(&xtest_teec_ctx, &out)))
+		goto out;
+
+	ref = malloc(max_size);
+	if (!ADBG_EXPECT_NOT_NULL(c, ref))
+		goto out;
+
+	for (n = 0; n < max_size; n++)
+		((uint8_t *)in.buffer)[n] = n * 7 + (n >> 8);
+
+	/* The first entry is the reference and must always be there */
+	for (i = 0; i < ARRAY_SIZE(aes_impls); i++) {
+		res = aes_ecb_invoke(s, cmd, aes_impls[i].impl, &in, &out,
+				     16);
+		avail[i] = res == TEEC_SUCCESS;
+		if ((!i || res != TEEC_ERROR_NOT_SUPPORTED) &&
+		    !ADBG_EXPECT_TEEC_SUCCESS(c, res))
+			goto out;
+		if (!avail[i])
+			Do_ADBG_Log("%s: not supported by the TA",
+				    aes_impls[i].name);
+	}
+
+	aes_ecb_print_header();
+
+	for (n = 0; crypt_data_size_table[n]; n++) {
+		size_t size = crypt_data_size_table[n];
+		size_t loops = bench_loops(size);
+		float ref_speed = 0;
+
+		printf(" %8zd \t ", size);
+		for (i = 0; i < ARRAY_SIZE(aes_impls); i++) {
+			uint64_t t;
+			float speed;
+
+			if (!avail[i]) {
+				printf("| %13s       ", "n/a");
+				continue;
+			}
+
+			/* Warm up, and check that all paths agree */
+			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+				aes_ecb_invoke(s, cmd, aes_impls[i].impl,
+					       &in, &out, size)))
+				goto out;
+			if (!i)
+				memcpy(ref, out.buffer, size);
+			else if (!ADBG_EXPECT_BUFFER(c, ref, size,
+						     out.buffer, size))
+				goto out;
+
+			t = bench_now_us();
+			for (l = 0; l < loops; l++) {
+				if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+					aes_ecb_invoke(s, cmd,
+						       aes_impls[i].impl,
+						       &in, &out, size)))
+					goto out;
+			}
+			t = bench_now_us() - t;
+			speed = bench_speed_in_kb(size, loops, t);
+			if (!i)
+				ref_speed = speed;
+			printf("| %11.1f (%5.2f) ", speed, speed / ref_speed);
+		}
+		printf("\n");
+	}
+
+	aes_ecb_print_sep();
+out:
+	free(ref);
+	TEEC_ReleaseSharedMemory(&out);
+	TEEC_ReleaseSharedMemory(&in);
+}
+
+static void xtest_tee_benchmark_2001(ADBG_Case_t *c)
+{
+	TEEC_Session session = { 0 };
+	uint32_t ret_orig;
+
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		xtest_teec_open_session(&session, &crypt_user_ta_uuid, NULL,
+					&ret_orig)))
+		return;
+
+	Do_ADBG_BeginSubCase(c, "AES-256 ECB encrypt");
+	aes_ecb_bench(c, &session, TA_CRYPT_CMD_AES256ECB_ENC);
+	Do_ADBG_EndSubCase(c, "AES-256 ECB encrypt");
+
+	Do_ADBG_BeginSubCase(c, "AES-256 ECB decrypt");
+	aes_ecb_bench(c, &session, TA_CRYPT_CMD_AES256ECB_DEC);
+	Do_ADBG_EndSubCase(c, "AES-256 ECB decrypt");
+
+	TEEC_CloseSession(&session);
+}
+
+static TEEC_Result sha256_bench_invoke(TEEC_Session *s,
+				       TEEC_SharedMemory *in, size_t size,
+				       uint32_t loops, uint32_t *times,
+				       uint8_t *digests)
+{
+	TEEC_Operation op = TEEC_OPERATION_INITIALIZER;
+	uint32_t ret_orig;
+
+	op.params[0].memref.parent = in;
+	op.params[0].memref.offset = 0;
+	op.params[0].memref.size = size;
+	op.params[1].value.a = loops;
+	op.params[2].tmpref.buffer = times;
+	op.params[2].tmpref.size = TA_CRYPT_SHA256_IMPL_COUNT *
+				   sizeof(uint32_t);
+	op.params[3].tmpref.buffer = digests;
+	op.params[3].tmpref.size = TA_CRYPT_SHA256_IMPL_COUNT * 32;
+	op.paramTypes = TEEC_PARAM_TYPES(TEEC_MEMREF_PARTIAL_INPUT,
+					 TEEC_VALUE_INPUT,
+					 TEEC_MEMREF_TEMP_OUTPUT,
+					 TEEC_MEMREF_TEMP_OUTPUT);
+
+	return TEEC_InvokeCommand(s, TA_CRYPT_CMD_SHA256_BENCH, &op,
+				  &ret_orig);
+}
+
+static void xtest_tee_benchmark_2002(ADBG_Case_t *c)
+{
+	size_t max_size = 1024 * 1024;
+	TEEC_Session session = { 0 };
+	TEEC_SharedMemory in = { 0 };
+	uint32_t times[TA_CRYPT_SHA256_IMPL_COUNT];
+	uint8_t digests[TA_CRYPT_SHA256_IMPL_COUNT][32];
+	uint32_t ret_orig;
+	size_t n;
+	size_t i;
+
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		xtest_teec_open_session(&session, &crypt_user_ta_uuid, NULL,
+					&ret_orig)))
+		return;
+
+	in.size = max_size;
+	in.flags = TEEC_MEM_INPUT;
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		TEEC_AllocateSharedMemory(&xtest_teec_ctx, &in)))
+		goto out;
+
+	for (n = 0; n < max_size; n++)
+		((uint8_t *)in.buffer)[n] = n * 13 + (n >> 9);
+
+	printf("-----------------");
+	for (i = 0; i < TA_CRYPT_SHA256_IMPL_COUNT; i++)
+		printf("+----------------");
+	printf("\n Data Size (B) \t ");
+	for (i = 0; i < TA_CRYPT_SHA256_IMPL_COUNT; i++)
+		printf("| %-8s kB/s  ", sha256_impl_names[i]);
+	printf("\n-----------------");
+	for (i = 0; i < TA_CRYPT_SHA256_IMPL_COUNT; i++)
+		printf("+----------------");
+	printf("\n");
+
+	for (n = 0; crypt_data_size_table[n]; n++) {
+		size_t size = crypt_data_size_table[n];
+		uint32_t loops = SHA256_BENCH_TOTAL_SIZE / size;
+
+		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+			sha256_bench_invoke(&session, &in, size, loops,
+					    times, &digests[0][0])))
+			break;
+
+		printf(" %8zd \t ", size);
+		for (i = 0; i < TA_CRYPT_SHA256_IMPL_COUNT; i++) {
+			if (times[i] == TA_CRYPT_BENCH_NOT_AVAILABLE) {
+				printf("| %11s    ", "n/a");
+				continue;
+			}
+			/* All variants must agree with the rolled one */
+			ADBG_EXPECT_BUFFER(c, digests[0], 32, digests[i], 32);
+			printf("| %11.1f    ",
+			       bench_speed_in_kb(size, loops,
+						 (uint64_t)times[i] * 1000));
+		}
+		printf("\n");
+	}
+
+	printf("-----------------");
+	for (i = 0; i < TA_CRYPT_SHA256_IMPL_COUNT; i++)
+		printf("+----------------");
+	printf("\n");
+
+	TEEC_ReleaseSharedMemory(&in);
+out:
+	TEEC_CloseSession(&session);
+}
+
+#define SHA256_MULTI_NUM_MSGS 256
+#define SHA256_MULTI_ROUNDS 10
+
+static const size_t sha256_multi_msg_size_table[] = {
+	64, 128, 256, 512, 0
+};
+
+static TEEC_Result sha256_single_invoke(TEEC_Session *s,
+					TEEC_SharedMemory *in, size_t offs,
+					size_t size, uint8_t *digest)
+{
+	TEEC_Operation op = TEEC_OPERATION_INITIALIZER;
+	uint32_t ret_orig;
+
+	op.params[0].memref.parent = in;
+	op.params[0].memref.offset = offs;
+	op.params[0].memref.size = size;
+	op.params[1].tmpref.buffer = digest;
+	op.params[1].tmpref.size = 32;
+	op.paramTypes = TEEC_PARAM_TYPES(TEEC_MEMREF_PARTIAL_INPUT,
+					 TEEC_MEMREF_TEMP_OUTPUT,
+					 TEEC_NONE, TEEC_NONE);
+
+	return TEEC_InvokeCommand(s, TA_CRYPT_CMD_SHA256, &op, &ret_orig);
+}
+
+static TEEC_Result sha256_multi_invoke(TEEC_Session *s,
+				       struct ta_crypt_sha256_msg *msgs,
+				       size_t num_msgs, TEEC_SharedMemory *in,
+				       size_t size, uint8_t *digests)
+{
+	TEEC_Operation op = TEEC_OPERATION_INITIALIZER;
+	uint32_t ret_orig;
+
+	op.params[0].tmpref.buffer = msgs;
+	op.params[0].tmpref.size = num_msgs * sizeof(*msgs);
+	op.params[1].memref.parent = in;
+	op.params[1].memref.offset = 0;
+	op.params[1].memref.size = size;
+	op.params[2].tmpref.buffer = digests;
+	op.params[2].tmpref.size = num_msgs * 32;
+	op.paramTypes = TEEC_PARAM_TYPES(TEEC_MEMREF_TEMP_INPUT,
+					 TEEC_MEMREF_PARTIAL_INPUT,
+					 TEEC_MEMREF_TEMP_OUTPUT, TEEC_NONE);
+
+	return TEEC_InvokeCommand(s, TA_CRYPT_CMD_SHA256_MULTI, &op,
+				  &ret_orig);
+}
+
+static void xtest_tee_benchmark_2003(ADBG_Case_t *c)
+{
+	size_t num_msgs = SHA256_MULTI_NUM_MSGS;
+	size_t max_size = num_msgs * 512;
+	TEEC_Session session = { 0 };
+	TEEC_SharedMemory in = { 0 };
+	struct ta_crypt_sha256_msg msgs[SHA256_MULTI_NUM_MSGS];
+	static uint8_t ref[SHA256_MULTI_NUM_MSGS][32];
+	static uint8_t digests[SHA256_MULTI_NUM_MSGS][32];
+	uint32_t ret_orig;
+	size_t n;
+	size_t m;
+	size_t r;
+
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		xtest_teec_open_session(&session, &crypt_user_ta_uuid, NULL,
+					&ret_orig)))
+		return;
+
+	in.size = max_size;
+	in.flags = TEEC_MEM_INPUT;
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		TEEC_AllocateSharedMemory(&xtest_teec_ctx, &in)))
+		goto out;
+
+	for (n = 0; n < max_size; n++)
+		((uint8_t *)in.buffer)[n] = n * 5 + (n >> 7);
+
+	printf("-----------------+-------+----------------+----------------+--------\n");
+	printf(" Msg Size (B) \t | Count | single (msg/s) | multi (msg/s)  | Speedup\n");
+	printf("-----------------+-------+----------------+----------------+--------\n");
+
+	for (n = 0; sha256_multi_msg_size_table[n]; n++) {
+		size_t size = sha256_multi_msg_size_table[n];
+		uint64_t t_single;
+		uint64_t t_multi;
+		float single;
+		float multi;
+
+		for (m = 0; m < num_msgs; m++) {
+			msgs[m].offs = m * size;
+			msgs[m].len = size;
+		}
+
+		t_single = bench_now_us();
+		for (r = 0; r < SHA256_MULTI_ROUNDS; r++) {
+			for (m = 0; m < num_msgs; m++) {
+				if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+					sha256_single_invoke(&session, &in,
+							     msgs[m].offs,
+							     size, ref[m])))
+					goto out_shm;
+			}
+		}
+		t_single = bench_now_us() - t_single;
+
+		t_multi = bench_now_us();
+		for (r = 0; r < SHA256_MULTI_ROUNDS; r++) {
+			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+				sha256_multi_invoke(&session, msgs, num_msgs,
+						    &in, num_msgs * size,
+						    &digests[0][0])))
+				goto out_shm;
+		}
+		t_multi = bench_now_us() - t_multi;
+
+		if (!ADBG_EXPECT_BUFFER(c, ref, sizeof(ref), digests,
+					sizeof(digests)))
+			goto out_shm;
+
+		single = (float)num_msgs * SHA256_MULTI_ROUNDS * 1000000.0 /
+			 (t_single ? t_single : 1);
+		multi = (float)num_msgs * SHA256_MULTI_ROUNDS * 1000000.0 /
+			(t_multi ? t_multi : 1);
+		printf(" %8zd \t | %5zd | %14.1f | %14.1f | %6.2f\n",
+		       size, num_msgs, single, multi, multi / single);
+	}
+
+	printf("-----------------+-------+----------------+----------------+--------\n");
+out_shm:
+	TEEC_ReleaseSharedMemory(&in);
+out:
+	TEEC_CloseSession(&session);
+}
+
+/*
+ * In-place versus two-buffer cipher updates. The sizes are allocated one
+ * at a time so that a small shared memory pool only skips the largest.
+ */
+#define INPLACE_BENCH_TOTAL_SIZE (64 * 1024 * 1024) /* 64MB */
+#define INPLACE_BENCH_MIN_LOOPS 4
+
+static const size_t inplace_size_table[] = {
+	64 * 1024,
+	256 * 1024,
+	1024 * 1024,
+	4 * 1024 * 1024,
+	16 * 1024 * 1024,
+	0
+};
+
+struct inplace_alg {
+	uint32_t algo;
+	uint32_t update_cmd;
+	const char *name;
+};
+
+static const struct inplace_alg inplace_algs[] = {
+	{ TEE_ALG_AES_CTR, TA_CRYPT_CMD_CIPHER_UPDATE, "AES-128 CTR" },
+	{ TEE_ALG_AES_GCM, TA_CRYPT_CMD_AE_UPDATE, "AES-128 GCM" },
+};
+
+static const uint8_t inplace_key[16] = {
+	0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+	0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c
+};
+
+/* Used as CTR IV and, the first 12 bytes, as GCM nonce */
+static const uint8_t inplace_iv[16] = {
+	0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+	0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff
+};
+
+static TEEC_Result inplace_op_init(ADBG_Case_t *c, TEEC_Session *s,
+				   const struct inplace_alg *alg,
+				   TEE_OperationHandle *oph)
+{
+	TEEC_Operation op = TEEC_OPERATION_INITIALIZER;
+	TEE_ObjectHandle key = TEE_HANDLE_NULL;
+	TEE_Attribute key_attr;
+	uint32_t ret_orig;
+	TEEC_Result res;
+
+	res = ta_crypt_cmd_allocate_operation(c, s, oph, alg->algo,
+					      TEE_MODE_ENCRYPT,
+					      sizeof(inplace_key) * 8);
+	if (res != TEEC_SUCCESS)
+		return res;
+
+	res = ta_crypt_cmd_allocate_transient_object(c, s, TEE_TYPE_AES,
+						     sizeof(inplace_key) * 8,
+						     &key);
+	if (res != TEEC_SUCCESS)
+		return res;
+
+	key_attr.attributeID = TEE_ATTR_SECRET_VALUE;
+	key_attr.content.ref.buffer = (void *)inplace_key;
+	key_attr.content.ref.length = sizeof(inplace_key);
+	res = ta_crypt_cmd_populate_transient_object(c, s, key, &key_attr, 1);
+	if (res == TEEC_SUCCESS)
+		res = ta_crypt_cmd_set_operation_key(c, s, *oph, key);
+	ta_crypt_cmd_free_transient_object(c, s, key);
+	if (res != TEEC_SUCCESS)
+		return res;
+
+	op.params[0].value.a = (uint32_t)(uintptr_t)*oph;
+	op.params[1].tmpref.buffer = (void *)inplace_iv;
+	if (alg->update_cmd == TA_CRYPT_CMD_AE_UPDATE) {
+		op.params[0].value.b = 16;	/* tag length */
+		op.params[1].tmpref.size = 12;
+		op.paramTypes = TEEC_PARAM_TYPES(TEEC_VALUE_INPUT,
+						 TEEC_MEMREF_TEMP_INPUT,
+						 TEEC_VALUE_INPUT, TEEC_NONE);
+		return TEEC_InvokeCommand(s, TA_CRYPT_CMD_AE_INIT, &op,
+					  &ret_orig);
+	}
+
+	op.params[1].tmpref.size = sizeof(inplace_iv);
+	op.paramTypes = TEEC_PARAM_TYPES(TEEC_VALUE_INPUT,
+					 TEEC_MEMREF_TEMP_INPUT,
+					 TEEC_NONE, TEEC_NONE);
+	return TEEC_InvokeCommand(s, TA_CRYPT_CMD_CIPHER_INIT, &op, &ret_orig);
+}
+
+/* Updates from in to out, or in place in in when out is NULL */
+static TEEC_Result inplace_update(TEEC_Session *s, uint32_t cmd,
+				  TEE_OperationHandle oph,
+				  TEEC_SharedMemory *in,
+				  TEEC_SharedMemory *out, size_t size)
+{
+	TEEC_Operation op = TEEC_OPERATION_INITIALIZER;
+	uint32_t ret_orig;
+
+	op.params[0].value.a = (uint32_t)(uintptr_t)oph;
+	op.params[1].memref.parent = in;
+	op.params[1].memref.offset = 0;
+	op.params[1].memref.size = size;
+	if (!out) {
+		op.paramTypes = TEEC_PARAM_TYPES(TEEC_VALUE_INPUT,
+						 TEEC_MEMREF_PARTIAL_INOUT,
+						 TEEC_NONE, TEEC_NONE);
+	} else {
+		op.params[2].memref.parent = out;
+		op.params[2].memref.offset = 0;
+		op.params[2].memref.size = size;
+		op.paramTypes = TEEC_PARAM_TYPES(TEEC_VALUE_INPUT,
+						 TEEC_MEMREF_PARTIAL_INPUT,
+						 TEEC_MEMREF_PARTIAL_OUTPUT,
+						 TEEC_NONE);
+	}
+
+	return TEEC_InvokeCommand(s, cmd, &op, &ret_orig);
+}
+
+static bool inplace_bench_size(ADBG_Case_t *c, TEEC_Session *s,
+			       const struct inplace_alg *alg, size_t size)
+{
+	TEE_OperationHandle op2buf = TEE_HANDLE_NULL;
+	TEE_OperationHandle op1buf = TEE_HANDLE_NULL;
+	TEEC_SharedMemory io = { 0 };
+	TEEC_SharedMemory out = { 0 };
+	size_t loops = INPLACE_BENCH_TOTAL_SIZE / size;
+	uint64_t t2buf;
+	uint64_t t1buf;
+	float speed2buf;
+	float speed1buf;
+	bool ret = false;
+	size_t n;
+
+	if (loops < INPLACE_BENCH_MIN_LOOPS)
+		loops = INPLACE_BENCH_MIN_LOOPS;
+
+	io.size = size;
+	io.flags = TEEC_MEM_INPUT | TEEC_MEM_OUTPUT;
+	out.size = size;
+	out.flags = TEEC_MEM_OUTPUT;
+	if (TEEC_AllocateSharedMemory(&xtest_teec_ctx, &io) != TEEC_SUCCESS) {
+		io.buffer = NULL;
+		goto no_shm;
+	}
+	if (TEEC_AllocateSharedMemory(&xtest_teec_ctx, &out) != TEEC_SUCCESS) {
+		out.buffer = NULL;
+		goto no_shm;
+	}
+
+	for (n = 0; n < size; n++)
+		((uint8_t *)io.buffer)[n] = n * 3 + (n >> 9);
+
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c, inplace_op_init(c, s, alg, &op2buf)))
+		goto out;
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c, inplace_op_init(c, s, alg, &op1buf)))
+		goto out;
+
+	/* Both paths start from the same state and must agree */
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		inplace_update(s, alg->update_cmd, op2buf, &io, &out, size)))
+		goto out;
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		inplace_update(s, alg->update_cmd, op1buf, &io, NULL, size)))
+		goto out;
+	if (!ADBG_EXPECT_BUFFER(c, out.buffer, size, io.buffer, size))
+		goto out;
+
+	t2buf = bench_now_us();
+	for (n = 0; n < loops; n++) {
+		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+			inplace_update(s, alg->update_cmd, op2buf, &io, &out,
+				       size)))
+			goto out;
+	}
+	t2buf = bench_now_us() - t2buf;
+
+	t1buf = bench_now_us();
+	for (n = 0; n < loops; n++) {
+		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+			inplace_update(s, alg->update_cmd, op1buf, &io, NULL,
+				       size)))
+			goto out;
+	}
+	t1buf = bench_now_us() - t1buf;
+
+	speed2buf = bench_speed_in_kb(size, loops, t2buf);
+	speed1buf = bench_speed_in_kb(size, loops, t1buf);
+	printf(" %8zd \t | %11.1f | %11.1f | %5.2f | %6zd / %6zd\n",
+	       size / 1024, speed2buf, speed1buf, speed1buf / speed2buf,
+	       2 * size / 1024, size / 1024);
+	ret = true;
+	goto out;
+
+no_shm:
+	printf(" %8zd \t | %11s | %11s | %5s | no shared memory\n",
+	       size / 1024, "n/a", "n/a", "n/a");
+	ret = true;
+out:
+	if (op1buf != TEE_HANDLE_NULL)
+		ta_crypt_cmd_free_operation(c, s, op1buf);
+	if (op2buf != TEE_HANDLE_NULL)
+		ta_crypt_cmd_free_operation(c, s, op2buf);
+	if (out.buffer)
+		TEEC_ReleaseSharedMemory(&out);
+	if (io.buffer)
+		TEEC_ReleaseSharedMemory(&io);
+	return ret;
+}
+
+static void xtest_tee_benchmark_2004(ADBG_Case_t *c)
+{
+	TEEC_Session session = { 0 };
+	uint32_t ret_orig;
+	size_t n;
+	size_t i;
+
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		xtest_teec_open_session(&session, &crypt_user_ta_uuid, NULL,
+					&ret_orig)))
+		return;
+
+	for (i = 0; i < ARRAY_SIZE(inplace_algs); i++) {
+		Do_ADBG_BeginSubCase(c, "%s update in place",
+				     inplace_algs[i].name);
+		printf("-----------------+-------------+-------------+-------+-----------------\n");
+		printf(" Data Size (kB)\t | 2 buf kB/s  | 1 buf kB/s  |   x   | shm kB 2 / 1 buf\n");
+		printf("-----------------+-------------+-------------+-------+-----------------\n");
+		for (n = 0; inplace_size_table[n]; n++)
+			if (!inplace_bench_size(c, &session, inplace_algs + i,
+						inplace_size_table[n]))
+				break;
+		printf("-----------------+-------------+-------------+-------+-----------------\n");
+		Do_ADBG_EndSubCase(c, "%s update in place",
+				   inplace_algs[i].name);
+	}
+
+	TEEC_CloseSession(&session);
+}
+
+/*
+ * Pipelined streaming through a ring of shared memory windows versus
+ * read, update and write of one window at a time. The "file" is
+ * generated from a pattern and the output folded into a checksum, both
+ * with a memcpy() to stand in for real I/O.
+ */
+#define STREAM_BENCH_TOTAL_SIZE (32 * 1024 * 1024) /* 32MB */
+#define STREAM_BENCH_IO_SIZE (1024 * 1024)
+
+static const size_t stream_window_size_table[] = {
+	64 * 1024,
+	256 * 1024,
+	1024 * 1024,
+	0
+};
+
+static const size_t stream_num_windows_table[] = { 2, 4, 0 };
+
+struct stream_bench_io {
+	uint8_t *src;
+	uint8_t *dst;
+	size_t pos;
+	uint64_t sum;
+};
+
+static size_t stream_bench_read(void *priv, void *buf, size_t len)
+{
+	struct stream_bench_io *io = priv;
+	size_t l = 0;
+
+	while (l < len && io->pos < STREAM_BENCH_TOTAL_SIZE) {
+		size_t offs = io->pos % STREAM_BENCH_IO_SIZE;
+		size_t n = MIN(len - l, STREAM_BENCH_IO_SIZE - offs);
+
+		memcpy((uint8_t *)buf + l, io->src + offs, n);
+		l += n;
+		io->pos += n;
+	}
+	return l;
+}
+
+static void stream_bench_write(void *priv, const void *buf, size_t len)
+{
+	struct stream_bench_io *io = priv;
+	size_t l = 0;
+	size_t n;
+
+	while (l < len) {
+		n = MIN(len - l, STREAM_BENCH_IO_SIZE);
+		memcpy(io->dst, (const uint8_t *)buf + l, n);
+		l += n;
+	}
+	for (n = 0; n + 8 <= len; n += 8) {
+		uint64_t v;
+
+		memcpy(&v, (const uint8_t *)buf + n, sizeof(v));
+		io->sum = (io->sum << 1 | io->sum >> 63) ^ v;
+	}
+}
+
+/* One window, nothing overlaps */
+static TEEC_Result stream_bench_serial(TEEC_Session *s,
+				       TEE_OperationHandle op,
+				       size_t window_size,
+				       struct stream_bench_io *io)
+{
+	TEEC_SharedMemory shm = { 0 };
+	TEEC_Result res;
+	size_t len;
+
+	shm.size = window_size;
+	shm.flags = TEEC_MEM_INPUT | TEEC_MEM_OUTPUT;
+	res = TEEC_AllocateSharedMemory(&xtest_teec_ctx, &shm);
+	if (res != TEEC_SUCCESS)
+		return res;
+
+	while ((len = stream_bench_read(io, shm.buffer, window_size))) {
+		res = inplace_update(s, TA_CRYPT_CMD_CIPHER_UPDATE, op, &shm,
+				     NULL, len);
+		if (res != TEEC_SUCCESS)
+			break;
+		stream_bench_write(io, shm.buffer, len);
+	}
+
+	TEEC_ReleaseSharedMemory(&shm);
+	return res;
+}
+
+static void xtest_tee_benchmark_2005(ADBG_Case_t *c)
+{
+	const struct inplace_alg *alg = inplace_algs; /* AES-128 CTR */
+	TEEC_Session session = { 0 };
+	TEE_OperationHandle op = TEE_HANDLE_NULL;
+	struct stream_bench_io io = { 0 };
+	uint64_t ref_sum;
+	uint32_t ret_orig;
+	size_t n;
+	size_t k;
+
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		xtest_teec_open_session(&session, &crypt_user_ta_uuid, NULL,
+					&ret_orig)))
+		return;
+
+	io.src = malloc(STREAM_BENCH_IO_SIZE);
+	io.dst = malloc(STREAM_BENCH_IO_SIZE);
+	if (!ADBG_EXPECT_NOT_NULL(c, io.src) ||
+	    !ADBG_EXPECT_NOT_NULL(c, io.dst))
+		goto out;
+	for (n = 0; n < STREAM_BENCH_IO_SIZE; n++)
+		io.src[n] = n * 11 + (n >> 10);
+
+	printf("-----------------+---------+-------------+-------------+------\n");
+	printf(" Window (kB)\t | Windows | serial kB/s | ring kB/s   |   x\n");
+	printf("-----------------+---------+-------------+-------------+------\n");
+
+	for (n = 0; stream_window_size_table[n]; n++) {
+		size_t window_size = stream_window_size_table[n];
+		float serial;
+		uint64_t t;
+
+		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+			inplace_op_init(c, &session, alg, &op)))
+			goto out;
+		io.pos = 0;
+		io.sum = 0;
+		t = bench_now_us();
+		if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+			stream_bench_serial(&session, op, window_size, &io)))
+			goto out;
+		t = bench_now_us() - t;
+		ref_sum = io.sum;
+		serial = bench_speed_in_kb(STREAM_BENCH_TOTAL_SIZE, 1, t);
+		ta_crypt_cmd_free_operation(c, &session, op);
+		op = TEE_HANDLE_NULL;
+
+		for (k = 0; stream_num_windows_table[k]; k++) {
+			size_t num_windows = stream_num_windows_table[k];
+			float ring;
+
+			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+				inplace_op_init(c, &session, alg, &op)))
+				goto out;
+			io.pos = 0;
+			io.sum = 0;
+			t = bench_now_us();
+			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+				xtest_cipher_stream(&session, op,
+					alg->update_cmd, num_windows,
+					window_size, stream_bench_read,
+					stream_bench_write, &io)))
+				goto out;
+			t = bench_now_us() - t;
+			ta_crypt_cmd_free_operation(c, &session, op);
+			op = TEE_HANDLE_NULL;
+
+			/* Same key and IV, so the output must match */
+			if (!ADBG_EXPECT_COMPARE_UNSIGNED(c, ref_sum, ==,
+							  io.sum))
+				goto out;
+
+			ring = bench_speed_in_kb(STREAM_BENCH_TOTAL_SIZE, 1,
+						 t);
+			printf(" %8zd \t | %7zd | %11.1f | %11.1f | %5.2f\n",
+			       window_size / 1024, num_windows, serial, ring,
+			       ring / serial);
+		}
+	}
+
+	printf("-----------------+---------+-------------+-------------+------\n");
+out:
+	if (op != TEE_HANDLE_NULL)
+		ta_crypt_cmd_free_operation(c, &session, op);
+	free(io.dst);
+	free(io.src);
+	TEEC_CloseSession(&session);
+}
+
+/*
+ * Shared prefix digests: the prefix is digested once and forked into
+ * each branch with TEE_CopyOperation(), versus digesting it again for
+ * each branch. With an empty prefix there's nothing to save, so that
+ * row shows what the copy costs.
+ */
+#define DIGEST_FORK_BENCH_TOTAL_SIZE (16 * 1024 * 1024) /* 16MB */
+#define DIGEST_FORK_MAX_LOOPS 1024
+#define DIGEST_FORK_SUFFIX_SIZE 64
+#define DIGEST_FORK_MAX_BRANCHES 64
+#define DIGEST_FORK_MAX_PREFIX_SIZE (256 * 1024)
+
+static const size_t digest_fork_prefix_size_table[] = {
+	0,
+	1024,
+	16 * 1024,
+	DIGEST_FORK_MAX_PREFIX_SIZE,
+};
+
+static const size_t digest_fork_branches_table[] = {
+	1, 4, 16, DIGEST_FORK_MAX_BRANCHES, 0
+};
+
+static TEEC_Result digest_fork_invoke(TEEC_Session *s,
+				      TEEC_SharedMemory *prefix,
+				      size_t prefix_size,
+				      TEEC_SharedMemory *suffixes,
+				      size_t num_branches, uint32_t flags,
+				      uint8_t *digests)
+{
+	TEEC_Operation op = TEEC_OPERATION_INITIALIZER;
+	uint32_t ret_orig;
+
+	op.params[0].value.a = TEE_ALG_SHA256;
+	op.params[0].value.b = num_branches | flags;
+	op.params[1].memref.parent = prefix;
+	op.params[1].memref.offset = 0;
+	op.params[1].memref.size = prefix_size;
+	op.params[2].memref.parent = suffixes;
+	op.params[2].memref.offset = 0;
+	op.params[2].memref.size = num_branches * DIGEST_FORK_SUFFIX_SIZE;
+	op.params[3].tmpref.buffer = digests;
+	op.params[3].tmpref.size = num_branches * TEE_SHA256_HASH_SIZE;
+	op.paramTypes = TEEC_PARAM_TYPES(TEEC_VALUE_INPUT,
+					 TEEC_MEMREF_PARTIAL_INPUT,
+					 TEEC_MEMREF_PARTIAL_INPUT,
+					 TEEC_MEMREF_TEMP_OUTPUT);
+
+	return TEEC_InvokeCommand(s, TA_CRYPT_CMD_DIGEST_FORK, &op,
+				  &ret_orig);
+}
+
+static void xtest_tee_benchmark_2006(ADBG_Case_t *c)
+{
+	TEEC_Session session = { 0 };
+	TEEC_SharedMemory prefix = { 0 };
+	TEEC_SharedMemory suffixes = { 0 };
+	static uint8_t ref[DIGEST_FORK_MAX_BRANCHES][TEE_SHA256_HASH_SIZE];
+	static uint8_t digests[DIGEST_FORK_MAX_BRANCHES][TEE_SHA256_HASH_SIZE];
+	uint32_t ret_orig;
+	size_t n;
+	size_t m;
+	size_t r;
+
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		xtest_teec_open_session(&session, &crypt_user_ta_uuid, NULL,
+					&ret_orig)))
+		return;
+
+	prefix.size = DIGEST_FORK_MAX_PREFIX_SIZE;
+	prefix.flags = TEEC_MEM_INPUT;
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		TEEC_AllocateSharedMemory(&xtest_teec_ctx, &prefix)))
+		goto out;
+
+	suffixes.size = DIGEST_FORK_MAX_BRANCHES * DIGEST_FORK_SUFFIX_SIZE;
+	suffixes.flags = TEEC_MEM_INPUT;
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		TEEC_AllocateSharedMemory(&xtest_teec_ctx, &suffixes)))
+		goto out_prefix;
+
+	for (n = 0; n < prefix.size; n++)
+		((uint8_t *)prefix.buffer)[n] = n * 3 + (n >> 8);
+	for (n = 0; n < suffixes.size; n++)
+		((uint8_t *)suffixes.buffer)[n] = n * 7 + 1;
+
+	printf("-----------------+----------+-----------------+-----------------+--------\n");
+	printf(" Prefix (B) \t | Branches | rehash (us/br)  | fork (us/br)    | Speedup\n");
+	printf("-----------------+----------+-----------------+-----------------+--------\n");
+
+	for (n = 0; n < ARRAY_SIZE(digest_fork_prefix_size_table); n++) {
+		size_t prefix_size = digest_fork_prefix_size_table[n];
+
+		for (m = 0; digest_fork_branches_table[m]; m++) {
+			size_t num_branches = digest_fork_branches_table[m];
+			size_t loops = DIGEST_FORK_BENCH_TOTAL_SIZE /
+				       ((prefix_size + DIGEST_FORK_SUFFIX_SIZE) *
+					num_branches);
+			uint64_t t_rehash;
+			uint64_t t_fork;
+			float rehash;
+			float fork;
+
+			if (loops > DIGEST_FORK_MAX_LOOPS)
+				loops = DIGEST_FORK_MAX_LOOPS;
+			if (!loops)
+				loops = 1;
+
+			t_rehash = bench_now_us();
+			for (r = 0; r < loops; r++) {
+				if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+					digest_fork_invoke(&session, &prefix,
+						prefix_size, &suffixes,
+						num_branches,
+						TA_CRYPT_DIGEST_FORK_REHASH,
+						&ref[0][0])))
+					goto out_suffixes;
+			}
+			t_rehash = bench_now_us() - t_rehash;
+
+			t_fork = bench_now_us();
+			for (r = 0; r < loops; r++) {
+				if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+					digest_fork_invoke(&session, &prefix,
+						prefix_size, &suffixes,
+						num_branches, 0,
+						&digests[0][0])))
+					goto out_suffixes;
+			}
+			t_fork = bench_now_us() - t_fork;
+
+			if (!ADBG_EXPECT_BUFFER(c, ref,
+					num_branches * TEE_SHA256_HASH_SIZE,
+					digests,
+					num_branches * TEE_SHA256_HASH_SIZE))
+				goto out_suffixes;
+
+			rehash = (float)t_rehash / (loops * num_branches);
+			fork = (float)t_fork / (loops * num_branches);
+			printf(" %8zd \t | %8zd | %15.2f | %15.2f | %6.2f\n",
+			       prefix_size, num_branches, rehash, fork,
+			       fork > 0 ? rehash / fork : 0);
+		}
+	}
+
+	printf("-----------------+----------+-----------------+-----------------+--------\n");
+out_suffixes:
+	TEEC_ReleaseSharedMemory(&suffixes);
+out_prefix:
+	TEEC_ReleaseSharedMemory(&prefix);
+out:
+	TEEC_CloseSession(&session);
+}
+
+/*
+ * RNG throughput. Every request size pulls roughly RNG_BENCH_TOTAL_SIZE
+ * bytes from TEE_GenerateRandom() while the output is run through
+ * monobit, runs and byte frequency tests as it arrives, so nothing
+ * but the last request is ever kept.
+ */
+#define RNG_BENCH_TOTAL_SIZE (256 * 1024 * 1024) /* 256MB */
+#define RNG_BENCH_MAX_LOOPS 16384
+#define RNG_BENCH_MAX_REQ_SIZE (1024 * 1024)
+#define RNG_BENCH_MAX_SIZES 16
+
+/* The default, replaced by the sizes given with --rng-sizes */
+static size_t rng_req_size_table[RNG_BENCH_MAX_SIZES + 1] = {
+	16,
+	256,
+	4 * 1024,
+	64 * 1024,
+	RNG_BENCH_MAX_REQ_SIZE,
+	0
+};
+
+bool xtest_benchmark_set_rng_sizes(const char *arg)
+{
+	size_t sizes[RNG_BENCH_MAX_SIZES + 1] = { 0 };
+	const char *p = arg;
+	unsigned long size;
+	size_t n = 0;
+	char *end;
+
+	do {
+		if (n == RNG_BENCH_MAX_SIZES || !isdigit((unsigned char)*p))
+			return false;
+		errno = 0;
+		size = strtoul(p, &end, 0);
+		if (errno || !size || size > RNG_BENCH_MAX_REQ_SIZE ||
+		    (*end && *end != ','))
+			return false;
+		sizes[n++] = size;
+		p = end + 1;
+	} while (*end);
+
+	memcpy(rng_req_size_table, sizes, sizeof(sizes));
+	return true;
+}
+
+/*
+ * The tests are run at a significance level of 0.0001 rather than the
+ * 0.01 of SP 800-22, a row is already several million bits and a
+ * benchmark run shouldn't fail one time in ten on a healthy RNG.
+ * RNG_Z2 is the square of the two sided normal quantile, RNG_CHI2_MAX
+ * the chi-square quantile for 255 degrees of freedom.
+ */
+#define RNG_Z2 15.137
+#define RNG_CHI2_MAX 347.7
+
+struct rng_stats {
+	uint64_t num_bits;
+	uint64_t ones;
+	uint64_t runs;
+	uint64_t freq[256];
+	int last_bit;
+};
+
+static void rng_stats_update(struct rng_stats *st, const uint8_t *buf,
+			     size_t len)
+{
+	size_t n;
+
+	for (n = 0; n < len; n++) {
+		uint8_t b = buf[n];
+
+		st->ones += __builtin_popcount(b);
+		st->freq[b]++;
+		/* Bits are taken MSB first, count where adjacent bits differ */
+		st->runs += __builtin_popcount((b ^ (b >> 1)) & 0x7f);
+		if (st->last_bit >= 0)
+			st->runs += st->last_bit != (b >> 7);
+		else
+			st->runs++;
+		st->last_bit = b & 1;
+	}
+	st->num_bits += len * 8;
+}
+
+/* SP 800-22 2.1, |S_n| / sqrt(n) compared squared to avoid libm */
+static bool rng_monobit_ok(const struct rng_stats *st)
+{
+	double s = (double)st->ones * 2 - (double)st->num_bits;
+
+	return s * s <= RNG_Z2 * st->num_bits;
+}
+
+/* SP 800-22 2.3, with its frequency prerequisite */
+static bool rng_runs_ok(const struct rng_stats *st)
+{
+	double n = st->num_bits;
+	double pi = st->ones / n;
+	double q = pi * (1 - pi);
+	double d = st->runs - 2 * n * q;
+
+	if ((pi - 0.5) * (pi - 0.5) * n >= 4)
+		return false;
+	return d * d <= RNG_Z2 * 8 * n * q * q;
+}
+
+static double rng_chi2(const struct rng_stats *st)
+{
+	double e = st->num_bits / 8 / 256.0;
+	double chi2 = 0;
+	size_t n;
+
+	for (n = 0; n < 256; n++) {
+		double d = st->freq[n] - e;
+
+		chi2 += d * d / e;
+	}
+	return chi2;
+}
+
+static TEEC_Result rng_invoke(TEEC_Session *s, TEEC_SharedMemory *shm,
+			      size_t size)
+{
+	TEEC_Operation op = TEEC_OPERATION_INITIALIZER;
+	uint32_t ret_orig;
+
+	op.params[0].memref.parent = shm;
+	op.params[0].memref.offset = 0;
+	op.params[0].memref.size = size;
+	op.paramTypes = TEEC_PARAM_TYPES(TEEC_MEMREF_PARTIAL_OUTPUT,
+					 TEEC_NONE, TEEC_NONE, TEEC_NONE);
+
+	return TEEC_InvokeCommand(s, TA_CRYPT_CMD_RANDOM_NUMBER_GENEREATE,
+				  &op, &ret_orig);
+}
+
+static void xtest_tee_benchmark_2007(ADBG_Case_t *c)
+{
+	TEEC_Session session = { 0 };
+	TEEC_SharedMemory shm = { 0 };
+	uint32_t ret_orig;
+	size_t n;
+	size_t r;
+
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		xtest_teec_open_session(&session, &crypt_user_ta_uuid, NULL,
+					&ret_orig)))
+		return;
+
+	shm.size = RNG_BENCH_MAX_REQ_SIZE;
+	shm.flags = TEEC_MEM_OUTPUT;
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		TEEC_AllocateSharedMemory(&xtest_teec_ctx, &shm)))
+		goto out;
+
+	printf("-----------------+------------+---------------+------------+------------+------------+---------+--------+----------\n");
+	printf(" Req size (B) \t | Total (MB) | Speed (kB/s)  | min (us)   | avg (us)   | max (us)   | Monobit | Runs   | Chi2\n");
+	printf("-----------------+------------+---------------+------------+------------+------------+---------+--------+----------\n");
+
+	for (n = 0; rng_req_size_table[n]; n++) {
+		size_t req_size = rng_req_size_table[n];
+		size_t loops = RNG_BENCH_TOTAL_SIZE / req_size;
+		struct rng_stats st = { .last_bit = -1 };
+		uint64_t t_min = UINT64_MAX;
+		uint64_t t_max = 0;
+		uint64_t t_sum = 0;
+		bool monobit;
+		bool runs;
+		double chi2;
+
+		if (loops > RNG_BENCH_MAX_LOOPS)
+			loops = RNG_BENCH_MAX_LOOPS;
+
+		for (r = 0; r < loops; r++) {
+			uint64_t t = bench_now_us();
+
+			if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+				rng_invoke(&session, &shm, req_size)))
+				goto out_shm;
+			t = bench_now_us() - t;
+			t_sum += t;
+			if (t < t_min)
+				t_min = t;
+			if (t > t_max)
+				t_max = t;
+
+			rng_stats_update(&st, shm.buffer, req_size);
+		}
+
+		monobit = rng_monobit_ok(&st);
+		runs = rng_runs_ok(&st);
+		chi2 = rng_chi2(&st);
+		printf(" %8zd \t | %10.1f | %13.2f | %10" PRIu64 " | %10.2f | %10" PRIu64 " | %-7s | %-6s | %8.1f\n",
+		       req_size, (float)req_size * loops / (1024 * 1024),
+		       bench_speed_in_kb(req_size, loops, t_sum), t_min,
+		       (float)t_sum / loops, t_max,
+		       monobit ? "pass" : "FAIL", runs ? "pass" : "FAIL",
+		       chi2);
+
+		ADBG_EXPECT_TRUE(c, monobit);
+		ADBG_EXPECT_TRUE(c, runs);
+		ADBG_EXPECT_TRUE(c, chi2 <= RNG_CHI2_MAX);
+	}
+
+	printf("-----------------+------------+---------------+------------+------------+------------+---------+--------+----------\n");
+out_shm:
+	TEEC_ReleaseSharedMemory(&shm);
+out:
+	TEEC_CloseSession(&session);
+}
+
+ADBG_CASE_DEFINE(XTEST_TEE_BENCHMARK_2001, xtest_tee_benchmark_2001,
+		/* Title */
+		"AES-256 ECB Performance Test",
+		/* Short description */
+		"Compare the AES implementations of the crypt TA",
+		/* Requirement IDs */ "",
+		/* How to implement */ ""
+		);
+
+ADBG_CASE_DEFINE(XTEST_TEE_BENCHMARK_2002, xtest_tee_benchmark_2002,
+		/* Title */
+		"SHA-256 Performance Test",
+		/* Short description */
+		"Compare the SHA-256 block functions of the crypt TA",
+		/* Requirement IDs */ "",
+		/* How to implement */ ""
+		);
+
+ADBG_CASE_DEFINE(XTEST_TEE_BENCHMARK_2003, xtest_tee_benchmark_2003,
+		/* Title */
+		"Multi-buffer SHA-256 Performance Test",
+		/* Short description */
+		"Hash many small messages, one invoke each versus one invoke for all",
+		/* Requirement IDs */ "",
+		/* How to implement */ ""
+		);
+
+ADBG_CASE_DEFINE(XTEST_TEE_BENCHMARK_2004, xtest_tee_benchmark_2004,
+		/* Title */
+		"In-place Cipher Update Performance Test",
+		/* Short description */
+		"Update in place in one shared memory buffer versus separate input and output",
+		/* Requirement IDs */ "",
+		/* How to implement */ ""
+		);
+
+ADBG_CASE_DEFINE(XTEST_TEE_BENCHMARK_2005, xtest_tee_benchmark_2005,
+		/* Title */
+		"Pipelined Cipher Streaming Performance Test",
+		/* Short description */
+		"Stream through a ring of shared memory windows versus one window at a time",
+		/* Requirement IDs */ "",
+		/* How to implement */ ""
+		);
+
+ADBG_CASE_DEFINE(XTEST_TEE_BENCHMARK_2006, xtest_tee_benchmark_2006,
+		/* Title */
+		"Digest Operation Fork Performance Test",
+		/* Short description */
+		"Fork a digested prefix with TEE_CopyOperation versus digesting it again",
+		/* Requirement IDs */ "",
+		/* How to implement */ ""
+		);
+
+ADBG_CASE_DEFINE(XTEST_TEE_BENCHMARK_2007, xtest_tee_benchmark_2007,
+		/* Title */
+		"RNG Throughput Test",
+		/* Short description */
+		"Pull random data in different request sizes and check it with monobit, runs and chi-square tests",
+		/* Requirement IDs */ "",
+		/* How to implement */ ""
+		);
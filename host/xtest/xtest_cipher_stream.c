@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2015, Linaro Limited
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License Version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ */
+
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "xtest_cipher_stream.h"
+#include "xtest_helpers.h"
+
+enum stream_win_state {
+	STREAM_WIN_FREE,	/* owned by the host, may be filled */
+	STREAM_WIN_FILLED,	/* waiting for the worker */
+	STREAM_WIN_DONE,	/* processed, output ready to be written */
+};
+
+struct stream_win {
+	TEEC_SharedMemory shm;
+	size_t len;
+	enum stream_win_state state;
+};
+
+struct stream_ctx {
+	TEEC_Session *session;
+	TEE_OperationHandle op;
+	uint32_t update_cmd;
+	struct stream_win *wins;
+	size_t num_wins;
+	size_t num_filled;	/* windows filled so far */
+	bool eof;
+	TEEC_Result res;
+	pthread_mutex_t mu;
+	pthread_cond_t cv;
+};
+
+static TEEC_Result stream_update(struct stream_ctx *ctx, struct stream_win *w)
+{
+	TEEC_Operation op = TEEC_OPERATION_INITIALIZER;
+	uint32_t ret_orig;
+	TEEC_Result res;
+
+	op.params[0].value.a = (uint32_t)(uintptr_t)ctx->op;
+	op.params[1].memref.parent = &w->shm;
+	op.params[1].memref.offset = 0;
+	op.params[1].memref.size = w->len;
+	op.paramTypes = TEEC_PARAM_TYPES(TEEC_VALUE_INPUT,
+					 TEEC_MEMREF_PARTIAL_INOUT,
+					 TEEC_NONE, TEEC_NONE);
+
+	res = TEEC_InvokeCommand(ctx->session, ctx->update_cmd, &op,
+				 &ret_orig);
+	if (res == TEEC_SUCCESS)
+		w->len = op.params[1].memref.size;
+	return res;
+}
+
+/*
+ * Reads until buf is full or read_fn() returns 0. Only the last window
+ * may be short: the TA keeps the bytes of a window that don't fill a
+ * block, so the output of the next window wouldn't fit in it.
+ */
+static size_t stream_fill(xtest_stream_read_fn read_fn, void *priv,
+			  uint8_t *buf, size_t size, bool *eof)
+{
+	size_t len = 0;
+	size_t n;
+
+	while (len < size) {
+		n = read_fn(priv, buf + len, size - len);
+		if (!n) {
+			*eof = true;
+			break;
+		}
+		len += n;
+	}
+	return len;
+}
+
+static void *stream_worker(void *arg)
+{
+	struct stream_ctx *ctx = arg;
+	size_t n = 0;
+
+	pthread_mutex_lock(&ctx->mu);
+	while (ctx->res == TEEC_SUCCESS) {
+		struct stream_win *w = ctx->wins + n % ctx->num_wins;
+		TEEC_Result res;
+
+		if (w->state != STREAM_WIN_FILLED) {
+			if (ctx->eof && n == ctx->num_filled)
+				break;
+			pthread_cond_wait(&ctx->cv, &ctx->mu);
+			continue;
+		}
+
+		/* The window is ours until it's marked done */
+		pthread_mutex_unlock(&ctx->mu);
+		res = stream_update(ctx, w);
+		pthread_mutex_lock(&ctx->mu);
+
+		if (res != TEEC_SUCCESS)
+			ctx->res = res;
+		w->state = STREAM_WIN_DONE;
+		pthread_cond_broadcast(&ctx->cv);
+		n++;
+	}
+	pthread_mutex_unlock(&ctx->mu);
+	return NULL;
+}
+
+TEEC_Result xtest_cipher_stream(TEEC_Session *s, TEE_OperationHandle op,
+				uint32_t update_cmd, size_t num_windows,
+				size_t window_size,
+				xtest_stream_read_fn read_fn,
+				xtest_stream_write_fn write_fn, void *priv)
+{
+	struct stream_ctx ctx;
+	pthread_t thr;
+	TEEC_Result res = TEEC_SUCCESS;
+	size_t num_written = 0;
+	size_t n;
+
+	if (!num_windows || !window_size)
+		return TEEC_ERROR_BAD_PARAMETERS;
+
+	memset(&ctx, 0, sizeof(ctx));
+	ctx.session = s;
+	ctx.op = op;
+	ctx.update_cmd = update_cmd;
+	ctx.num_wins = num_windows;
+	ctx.wins = calloc(num_windows, sizeof(*ctx.wins));
+	if (!ctx.wins)
+		return TEEC_ERROR_OUT_OF_MEMORY;
+
+	for (n = 0; n < num_windows; n++) {
+		ctx.wins[n].shm.size = window_size;
+		ctx.wins[n].shm.flags = TEEC_MEM_INPUT | TEEC_MEM_OUTPUT;
+		res = TEEC_AllocateSharedMemory(&xtest_teec_ctx,
+						&ctx.wins[n].shm);
+		if (res != TEEC_SUCCESS) {
+			ctx.wins[n].shm.buffer = NULL;
+			goto out;
+		}
+	}
+
+	pthread_mutex_init(&ctx.mu, NULL);
+	pthread_cond_init(&ctx.cv, NULL);
+	if (pthread_create(&thr, NULL, stream_worker, &ctx)) {
+		res = TEEC_ERROR_GENERIC;
+		goto out_sync;
+	}
+
+	/*
+	 * Keep as many windows as possible filled ahead of the worker and
+	 * write out the oldest one whenever the ring is full.
+	 */
+	pthread_mutex_lock(&ctx.mu);
+	while (ctx.res == TEEC_SUCCESS) {
+		struct stream_win *w;
+
+		if (!ctx.eof && ctx.num_filled - num_written < num_windows) {
+			bool eof = false;
+			size_t len;
+
+			w = ctx.wins + ctx.num_filled % num_windows;
+			pthread_mutex_unlock(&ctx.mu);
+			len = stream_fill(read_fn, priv, w->shm.buffer,
+					  window_size, &eof);
+			pthread_mutex_lock(&ctx.mu);
+
+			if (len) {
+				w->len = len;
+				w->state = STREAM_WIN_FILLED;
+				ctx.num_filled++;
+			}
+			if (eof)
+				ctx.eof = true;
+			pthread_cond_broadcast(&ctx.cv);
+			continue;
+		}
+
+		if (num_written == ctx.num_filled)
+			break;	/* eof and all written */
+
+		w = ctx.wins + num_written % num_windows;
+		if (w->state != STREAM_WIN_DONE) {
+			pthread_cond_wait(&ctx.cv, &ctx.mu);
+			continue;
+		}
+
+		pthread_mutex_unlock(&ctx.mu);
+		write_fn(priv, w->shm.buffer, w->len);
+		pthread_mutex_lock(&ctx.mu);
+
+		w->state = STREAM_WIN_FREE;
+		num_written++;
+	}
+	/* Make sure the worker wakes up and stops on error */
+	ctx.eof = true;
+	if (ctx.res != TEEC_SUCCESS)
+		res = ctx.res;
+	pthread_cond_broadcast(&ctx.cv);
+	pthread_mutex_unlock(&ctx.mu);
+
+	pthread_join(thr, NULL);
+	if (ctx.res != TEEC_SUCCESS)
+		res = ctx.res;
+out_sync:
+	pthread_cond_destroy(&ctx.cv);
+	pthread_mutex_destroy(&ctx.mu);
+out:
+	for (n = 0; n < num_windows; n++)
+		if (ctx.wins[n].shm.buffer)
+			TEEC_ReleaseSharedMemory(&ctx.wins[n].shm);
+	free(ctx.wins);
+	return res;
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2015, Linaro Limited
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License Version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ */
+
+
+#ifndef XTEST_CIPHER_STREAM_H
+#define XTEST_CIPHER_STREAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <tee_client_api.h>
+#include <tee_api_types.h>
+
+/*
+ * Fills buf with up to len bytes of input and returns the number of
+ * bytes, 0 at the end of the input. It may return less than len before
+ * the end, as read() does, it's then called again for the rest.
+ */
+typedef size_t (*xtest_stream_read_fn)(void *priv, void *buf, size_t len);
+/* Consumes len bytes of output */
+typedef void (*xtest_stream_write_fn)(void *priv, const void *buf,
+				      size_t len);
+
+/*
+ * Streams the input from read_fn() through an initialized cipher or AE
+ * operation and passes the output to write_fn(). update_cmd is
+ * TA_CRYPT_CMD_CIPHER_UPDATE or TA_CRYPT_CMD_AE_UPDATE, the caller does
+ * the final.
+ *
+ * The data goes through a ring of num_windows registered shared memory
+ * windows of window_size bytes each, updated in place. A worker thread
+ * does the invokes, so the host reads window i + 1 and writes window
+ * i - 1 while the TA processes window i. window_size must be a multiple
+ * of the cipher block size.
+ */
+TEEC_Result xtest_cipher_stream(TEEC_Session *s, TEE_OperationHandle op,
+				uint32_t update_cmd, size_t num_windows,
+				size_t window_size,
+				xtest_stream_read_fn read_fn,
+				xtest_stream_write_fn write_fn, void *priv);
+
+#endif /*XTEST_CIPHER_STREAM_H*/
@@ -21,6 +21,10 @@
 #include <stdio.h>
 #include <malloc.h>
 #include <assert.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
 
 /* Round up the even multiple of size, size has to be a multiple of 2 */
 #define ROUNDUP(v, size) (((v) + (size - 1)) & ~(size - 1))
@@ -45,6 +49,258 @@ void xtest_teec_ctx_deinit(void)
 	TEEC_FinalizeContext(&xtest_teec_ctx);
 }
 
+bool xtest_reuse_sessions;
+
+struct pooled_ta {
+	TEEC_UUID uuid;
+	size_t num_leases;	/* Served from the pool */
+	size_t num_opens;	/* Opened into the pool */
+	uint64_t open_us;	/* Spent on num_opens */
+};
+
+struct pooled_session {
+	TEEC_Session session;
+	size_t ta;		/* Index in tas of the session pool */
+	bool leased;
+	bool dead;		/* An invoke returned TEEC_ERROR_TARGET_DEAD */
+};
+
+/*
+ * Kept in the suite data and only used by the suite process, forked jobs
+ * don't reuse sessions, see fork_init().
+ */
+struct session_pool {
+	pthread_mutex_t mu;
+	struct pooled_ta *tas;
+	size_t num_tas;
+	struct pooled_session *sessions;
+	size_t num_sessions;
+};
+
+/* The pool of the running suite, for __wrap_TEEC_InvokeCommand() */
+static struct session_pool *session_pool;
+
+static uint64_t time_us(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static struct session_pool *get_session_pool(ADBG_Case_t *c)
+{
+	ADBG_SuiteData_t *suite_data = Do_ADBG_GetSuiteData(c);
+	struct session_pool *pool = suite_data->Data_p;
+
+	if (pool)
+		return pool;
+
+	pool = calloc(1, sizeof(*pool));
+	if (!pool)
+		return NULL;
+	pthread_mutex_init(&pool->mu, NULL);
+	suite_data->Data_p = pool;
+	session_pool = pool;
+	return pool;
+}
+
+/* Returns the index of uuid in pool->tas, adding it if needed, or -1 */
+static ssize_t get_pooled_ta(struct session_pool *pool, const TEEC_UUID *uuid)
+{
+	struct pooled_ta *tas;
+	size_t n;
+
+	for (n = 0; n < pool->num_tas; n++)
+		if (!memcmp(&pool->tas[n].uuid, uuid, sizeof(*uuid)))
+			return n;
+
+	tas = realloc(pool->tas, (n + 1) * sizeof(*tas));
+	if (!tas)
+		return -1;
+	pool->tas = tas;
+	memset(tas + n, 0, sizeof(*tas));
+	tas[n].uuid = *uuid;
+	pool->num_tas++;
+	return n;
+}
+
+TEEC_Result xtest_teec_lease_session(ADBG_Case_t *c, TEEC_Session *session,
+				     const TEEC_UUID *uuid,
+				     uint32_t *ret_orig)
+{
+	struct session_pool *pool = NULL;
+	struct pooled_session *sessions;
+	TEEC_Result res;
+	uint64_t t;
+	ssize_t ta = -1;
+	size_t n;
+
+	if (xtest_reuse_sessions)
+		pool = get_session_pool(c);
+	if (!pool)
+		return xtest_teec_open_session(session, uuid, NULL, ret_orig);
+
+	pthread_mutex_lock(&pool->mu);
+	ta = get_pooled_ta(pool, uuid);
+	if (ta >= 0) {
+		for (n = 0; n < pool->num_sessions; n++) {
+			if (pool->sessions[n].leased ||
+			    pool->sessions[n].ta != (size_t)ta)
+				continue;
+			pool->sessions[n].leased = true;
+			pool->tas[ta].num_leases++;
+			*session = pool->sessions[n].session;
+			pthread_mutex_unlock(&pool->mu);
+			if (ret_orig)
+				*ret_orig = TEEC_ORIGIN_TRUSTED_APP;
+			return TEEC_SUCCESS;
+		}
+	}
+	pthread_mutex_unlock(&pool->mu);
+
+	t = time_us();
+	res = xtest_teec_open_session(session, uuid, NULL, ret_orig);
+	t = time_us() - t;
+	if (ta < 0 || res != TEEC_SUCCESS)
+		return res;
+
+	pthread_mutex_lock(&pool->mu);
+	/* If there's no room the session is closed when released */
+	sessions = realloc(pool->sessions,
+			   (pool->num_sessions + 1) * sizeof(*sessions));
+	if (sessions) {
+		pool->sessions = sessions;
+		sessions[pool->num_sessions].session = *session;
+		sessions[pool->num_sessions].ta = ta;
+		sessions[pool->num_sessions].leased = true;
+		sessions[pool->num_sessions].dead = false;
+		pool->num_sessions++;
+		pool->tas[ta].num_leases++;
+		pool->tas[ta].num_opens++;
+		pool->tas[ta].open_us += t;
+	}
+	pthread_mutex_unlock(&pool->mu);
+	return res;
+}
+
+void xtest_teec_release_session(ADBG_Case_t *c, TEEC_Session *session)
+{
+	struct session_pool *pool = Do_ADBG_GetSuiteData(c)->Data_p;
+	size_t n;
+
+	if (xtest_reuse_sessions && pool) {
+		pthread_mutex_lock(&pool->mu);
+		for (n = 0; n < pool->num_sessions; n++) {
+			struct pooled_session *s = pool->sessions + n;
+
+			if (!s->leased ||
+			    memcmp(&s->session, session, sizeof(*session)))
+				continue;
+			if (!s->dead && !Do_ADBG_CaseFailed(c)) {
+				s->leased = false;
+				pthread_mutex_unlock(&pool->mu);
+				return;
+			}
+			/*
+			 * The TA is dead, possibly on purpose, or may be in a
+			 * bad state, start afresh.
+			 */
+			*s = pool->sessions[--pool->num_sessions];
+			break;
+		}
+		pthread_mutex_unlock(&pool->mu);
+	}
+
+	TEEC_CloseSession(session);
+}
+
+void xtest_session_pool_cleanup(ADBG_SuiteData_t *suite_data)
+{
+	struct session_pool *pool = suite_data->Data_p;
+	uint64_t saved_us = 0;
+	size_t num_leases = 0;
+	size_t n;
+
+	if (!pool)
+		return;
+	suite_data->Data_p = NULL;
+	session_pool = NULL;
+
+	Do_ADBG_Log("Session pool:");
+	for (n = 0; n < pool->num_tas; n++) {
+		const struct pooled_ta *ta = pool->tas + n;
+		const TEEC_UUID *u = &ta->uuid;
+		uint64_t open_us = 0;
+
+		if (ta->num_opens)
+			open_us = ta->open_us / ta->num_opens;
+		num_leases += ta->num_leases;
+		saved_us += (ta->num_leases - ta->num_opens) * open_us;
+		Do_ADBG_Log("%08x-%04x-%04x-%02x%02x-%02x%02x%02x%02x%02x%02x "
+			    "%zu leases, %zu opened, %.1f ms per open",
+			    u->timeLow, u->timeMid, u->timeHiAndVersion,
+			    u->clockSeqAndNode[0], u->clockSeqAndNode[1],
+			    u->clockSeqAndNode[2], u->clockSeqAndNode[3],
+			    u->clockSeqAndNode[4], u->clockSeqAndNode[5],
+			    u->clockSeqAndNode[6], u->clockSeqAndNode[7],
+			    ta->num_leases, ta->num_opens, open_us / 1000.0);
+	}
+	Do_ADBG_Log("%zu leases of %zu pooled sessions, about %.3f s saved",
+		    num_leases, pool->num_sessions, saved_us / 1e6);
+
+	for (n = 0; n < pool->num_sessions; n++)
+		TEEC_CloseSession(&pool->sessions[n].session);
+	pthread_mutex_destroy(&pool->mu);
+	free(pool->sessions);
+	free(pool->tas);
+	free(pool);
+}
+
+/* Keeps a pooled session whose TA has died out of the pool on release */
+static void mark_session_dead(struct session_pool *pool,
+			      const TEEC_Session *session)
+{
+	size_t n;
+
+	pthread_mutex_lock(&pool->mu);
+	for (n = 0; n < pool->num_sessions; n++)
+		if (!memcmp(&pool->sessions[n].session, session,
+			    sizeof(*session)))
+			pool->sessions[n].dead = true;
+	pthread_mutex_unlock(&pool->mu);
+}
+
+TEEC_Result __wrap_TEEC_InvokeCommand(TEEC_Session *session, uint32_t cmd,
+				      TEEC_Operation *op, uint32_t *ret_orig)
+{
+	TEEC_Operation null_op = TEEC_OPERATION_INITIALIZER;
+	TEEC_Result res;
+
+	/* Cancellation needs an operation, an empty one is the same as none */
+	if (!op)
+		op = &null_op;
+	/*
+	 * Set here too as the watchdog may cancel the operation before
+	 * TEEC_InvokeCommand() has got to it.
+	 */
+	op->session = session;
+
+	Do_ADBG_WatchOp(op);
+	res = __real_TEEC_InvokeCommand(session, cmd, op, ret_orig);
+	Do_ADBG_UnwatchOp(op);
+
+	if (res == TEEC_ERROR_TARGET_DEAD && xtest_reuse_sessions &&
+	    session_pool)
+		mark_session_dead(session_pool, session);
+	return res;
+}
+
+void xtest_teec_cancel_invoke(void *op)
+{
+	TEEC_RequestCancellation(op);
+}
+
 TEEC_Result ta_crypt_cmd_allocate_operation(ADBG_Case_t *c, TEEC_Session *s,
 					    TEE_OperationHandle *oph,
 					    uint32_t algo, uint32_t mode,
@@ -106,6 +362,230 @@ TEEC_Result ta_crypt_cmd_allocate_transient_object(ADBG_Case_t *c,
 	return res;
 }
 
+void xtest_batch_init(struct xtest_batch *b)
+{
+	memset(b, 0, sizeof(*b));
+}
+
+void xtest_batch_free(struct xtest_batch *b)
+{
+	free(b->cmds);
+	free(b->data);
+	free(b->outs);
+	memset(b, 0, sizeof(*b));
+}
+
+size_t xtest_batch_add(struct xtest_batch *b, uint32_t cmd_id,
+		       uint32_t param_types)
+{
+	struct ta_crypt_batch_cmd *cmds;
+
+	cmds = realloc(b->cmds, (b->num_cmds + 1) * sizeof(*cmds));
+	if (!cmds) {
+		b->res = TEEC_ERROR_OUT_OF_MEMORY;
+		/* Keep indexes sane, the batch is not invoked anyway */
+		return b->num_cmds ? b->num_cmds - 1 : 0;
+	}
+	b->cmds = cmds;
+
+	memset(cmds + b->num_cmds, 0, sizeof(*cmds));
+	cmds[b->num_cmds].cmd_id = cmd_id;
+	cmds[b->num_cmds].param_types = param_types;
+	return b->num_cmds++;
+}
+
+static struct ta_crypt_batch_param *batch_param(struct xtest_batch *b,
+						size_t cmd, size_t param)
+{
+	if (b->res != TEEC_SUCCESS)
+		return NULL;
+	if (cmd >= b->num_cmds || param >= 4) {
+		b->res = TEEC_ERROR_BAD_PARAMETERS;
+		return NULL;
+	}
+	return b->cmds[cmd].params + param;
+}
+
+void xtest_batch_value(struct xtest_batch *b, size_t cmd, size_t param,
+		       uint32_t a, uint32_t val_b)
+{
+	struct ta_crypt_batch_param *p = batch_param(b, cmd, param);
+
+	if (!p)
+		return;
+	p->a = a;
+	p->b = val_b;
+}
+
+void xtest_batch_ref(struct xtest_batch *b, size_t cmd, size_t param,
+		     size_t field, size_t src_cmd, size_t src_param,
+		     size_t src_field)
+{
+	struct ta_crypt_batch_param *p = batch_param(b, cmd, param);
+	uint32_t ref = TA_CRYPT_BATCH_REF(src_cmd, src_param, src_field);
+
+	if (!p)
+		return;
+	if (src_cmd >= cmd || src_param >= 4 || field > 1 || src_field > 1) {
+		b->res = TEEC_ERROR_BAD_PARAMETERS;
+		return;
+	}
+
+	if (field)
+		p->b = ref;
+	else
+		p->a = ref;
+	b->cmds[cmd].refs |= TA_CRYPT_BATCH_REF_BIT(param, field);
+}
+
+/* Reserves room in the data area, returns the offset or -1 */
+static ssize_t batch_alloc_data(struct xtest_batch *b, size_t len)
+{
+	size_t offs = ROUNDUP(b->data_len, 8);
+	uint8_t *data;
+
+	if (!len)
+		return b->data_len;
+	data = realloc(b->data, offs + len);
+	if (!data) {
+		b->res = TEEC_ERROR_OUT_OF_MEMORY;
+		return -1;
+	}
+	b->data = data;
+	memset(b->data + b->data_len, 0, offs + len - b->data_len);
+	b->data_len = offs + len;
+	return offs;
+}
+
+void xtest_batch_memref_in(struct xtest_batch *b, size_t cmd, size_t param,
+			   const void *buf, size_t len)
+{
+	struct ta_crypt_batch_param *p = batch_param(b, cmd, param);
+	ssize_t offs;
+
+	if (!p)
+		return;
+	offs = batch_alloc_data(b, len);
+	if (offs < 0)
+		return;
+	if (len)
+		memcpy(b->data + offs, buf, len);
+	p->a = offs;
+	p->b = len;
+}
+
+void xtest_batch_memref_out(struct xtest_batch *b, size_t cmd, size_t param,
+			    void *buf, size_t *len)
+{
+	struct ta_crypt_batch_param *p = batch_param(b, cmd, param);
+	struct xtest_batch_out *outs;
+	ssize_t offs;
+
+	if (!p)
+		return;
+	outs = realloc(b->outs, (b->num_outs + 1) * sizeof(*outs));
+	if (!outs) {
+		b->res = TEEC_ERROR_OUT_OF_MEMORY;
+		return;
+	}
+	b->outs = outs;
+
+	offs = batch_alloc_data(b, *len);
+	if (offs < 0)
+		return;
+	p->a = offs;
+	p->b = *len;
+
+	outs[b->num_outs].cmd = cmd;
+	outs[b->num_outs].param = param;
+	outs[b->num_outs].buf = buf;
+	outs[b->num_outs].len = len;
+	b->num_outs++;
+}
+
+void xtest_batch_attrs(struct xtest_batch *b, size_t cmd, size_t param,
+		       const TEE_Attribute *attrs, uint32_t attr_count)
+{
+	uint8_t *buf;
+	size_t blen;
+
+	if (pack_attrs(attrs, attr_count, &buf, &blen) != TEE_SUCCESS) {
+		b->res = TEEC_ERROR_OUT_OF_MEMORY;
+		return;
+	}
+	xtest_batch_memref_in(b, cmd, param, buf, blen);
+	free(buf);
+}
+
+void xtest_batch_get_value(struct xtest_batch *b, size_t cmd, size_t param,
+			   uint32_t *a, uint32_t *val_b)
+{
+	assert(cmd < b->num_cmds && param < 4);
+	if (a)
+		*a = b->cmds[cmd].params[param].a;
+	if (val_b)
+		*val_b = b->cmds[cmd].params[param].b;
+}
+
+TEEC_Result xtest_batch_invoke(ADBG_Case_t *c, TEEC_Session *s,
+			       struct xtest_batch *b)
+{
+	TEEC_Result res;
+	TEEC_Operation op = TEEC_OPERATION_INITIALIZER;
+	struct ta_crypt_batch_hdr *hdr;
+	size_t tbl_len = sizeof(*hdr) + b->num_cmds * sizeof(*b->cmds);
+	uint32_t ret_orig;
+	uint8_t *buf;
+	size_t n;
+
+	b->num_done = 0;
+	if (b->res != TEEC_SUCCESS)
+		return b->res;
+
+	buf = malloc(tbl_len + b->data_len);
+	if (!buf)
+		return TEEC_ERROR_OUT_OF_MEMORY;
+
+	hdr = (struct ta_crypt_batch_hdr *)(void *)buf;
+	hdr->num_cmds = b->num_cmds;
+	hdr->num_done = 0;
+	memcpy(hdr + 1, b->cmds, b->num_cmds * sizeof(*b->cmds));
+	memcpy(buf + tbl_len, b->data, b->data_len);
+
+	op.params[0].tmpref.buffer = buf;
+	op.params[0].tmpref.size = tbl_len + b->data_len;
+
+	op.paramTypes = TEEC_PARAM_TYPES(TEEC_MEMREF_TEMP_INOUT, TEEC_NONE,
+					 TEEC_NONE, TEEC_NONE);
+
+	res = TEEC_InvokeCommand(s, TA_CRYPT_CMD_BATCH, &op, &ret_orig);
+
+	if (res != TEEC_SUCCESS) {
+		(void)ADBG_EXPECT_TEEC_ERROR_ORIGIN(c, TEEC_ORIGIN_TRUSTED_APP,
+						    ret_orig);
+	}
+
+	/* Sub-command results and outputs are there even on failure */
+	b->num_done = hdr->num_done;
+	if (b->num_done > b->num_cmds)
+		b->num_done = b->num_cmds;
+	memcpy(b->cmds, hdr + 1, b->num_cmds * sizeof(*b->cmds));
+
+	for (n = 0; n < b->num_outs; n++) {
+		struct xtest_batch_out *o = b->outs + n;
+		struct ta_crypt_batch_param *p = b->cmds[o->cmd].params +
+						 o->param;
+
+		if (o->cmd < b->num_done && p->b <= *o->len)
+			memcpy(o->buf, buf + tbl_len + p->a, p->b);
+		if (o->cmd <= b->num_done)
+			*o->len = p->b;
+	}
+
+	free(buf);
+	return res;
+}
+
 void xtest_add_attr(size_t *attr_count, TEE_Attribute *attrs, uint32_t attr_id,
 		    const void *buf, size_t len)
 {
@@ -130,18 +610,13 @@ struct tee_attr_packed {
 	uint32_t b;
 };
 
-TEE_Result pack_attrs(const TEE_Attribute *attrs, uint32_t attr_count,
-		      uint8_t **buf, size_t *blen)
+size_t packed_attrs_size(const TEE_Attribute *attrs, uint32_t attr_count)
 {
-	struct tee_attr_packed *a;
-	uint8_t *b;
 	size_t bl;
 	size_t n;
 
-	*buf = NULL;
-	*blen = 0;
 	if (attr_count == 0)
-		return TEE_SUCCESS;
+		return 0;
 
 	bl = sizeof(uint32_t) + sizeof(struct tee_attr_packed) * attr_count;
 	for (n = 0; n < attr_count; n++) {
@@ -155,12 +630,42 @@ TEE_Result pack_attrs(const TEE_Attribute *attrs, uint32_t attr_count,
 		bl += ROUNDUP(attrs[n].content.ref.length, 4);
 	}
 
-	b = calloc(1, bl);
+	return bl;
+}
+
+TEE_Result pack_attrs(const TEE_Attribute *attrs, uint32_t attr_count,
+		      uint8_t **buf, size_t *blen)
+{
+	uint8_t *b;
+	size_t bl;
+
+	*buf = NULL;
+	*blen = 0;
+	if (attr_count == 0)
+		return TEE_SUCCESS;
+
+	bl = packed_attrs_size(attrs, attr_count);
+	b = malloc(bl);
 	if (!b)
 		return TEE_ERROR_OUT_OF_MEMORY;
 
+	pack_attrs_into(attrs, attr_count, b, bl);
 	*buf = b;
 	*blen = bl;
+	return TEE_SUCCESS;
+}
+
+void pack_attrs_into(const TEE_Attribute *attrs, uint32_t attr_count,
+		     uint8_t *buf, size_t blen)
+{
+	struct tee_attr_packed *a;
+	uint8_t *b = buf;
+	size_t n;
+
+	assert(blen >= packed_attrs_size(attrs, attr_count));
+	memset(buf, 0, blen);
+	if (attr_count == 0)
+		return;
 
 	*(uint32_t *)(void *)b = attr_count;
 	b += sizeof(uint32_t);
@@ -185,14 +690,12 @@ TEE_Result pack_attrs(const TEE_Attribute *attrs, uint32_t attr_count,
 		memcpy(b, attrs[n].content.ref.buffer,
 		       attrs[n].content.ref.length);
 
-		/* Make buffer pointer relative to *buf */
-		a[n].a = (uint32_t)(uintptr_t)(b - *buf);
+		/* Make buffer pointer relative to buf */
+		a[n].a = (uint32_t)(uintptr_t)(b - buf);
 
 		/* Round up to good alignment */
 		b += ROUNDUP(attrs[n].content.ref.length, 4);
 	}
-
-	return TEE_SUCCESS;
 }
 
 TEEC_Result ta_crypt_cmd_populate_transient_object(ADBG_Case_t *c,
@@ -233,6 +736,63 @@ TEEC_Result ta_crypt_cmd_populate_transient_object(ADBG_Case_t *c,
 	return res;
 }
 
+TEEC_Result xtest_pack_attrs_shm(TEEC_SharedMemory *shm,
+				 const TEE_Attribute *attrs,
+				 uint32_t attr_count, size_t *blen)
+{
+	TEEC_Result res;
+	size_t bl = packed_attrs_size(attrs, attr_count);
+
+	if (!shm->buffer || shm->size < bl) {
+		if (shm->buffer)
+			TEEC_ReleaseSharedMemory(shm);
+		shm->buffer = NULL;
+		shm->size = bl > 4096 ? ROUNDUP(bl, 4096) : 4096;
+		shm->flags = TEEC_MEM_INPUT;
+		res = TEEC_AllocateSharedMemory(&xtest_teec_ctx, shm);
+		if (res != TEEC_SUCCESS) {
+			shm->buffer = NULL;
+			return res;
+		}
+	}
+
+	pack_attrs_into(attrs, attr_count, shm->buffer, bl);
+	*blen = bl;
+	return TEEC_SUCCESS;
+}
+
+TEEC_Result ta_crypt_cmd_populate_transient_object_shm(ADBG_Case_t *c,
+						       TEEC_Session *s,
+						       TEE_ObjectHandle o,
+						       TEEC_SharedMemory *shm,
+						       size_t blen)
+{
+	TEEC_Result res;
+	TEEC_Operation op = TEEC_OPERATION_INITIALIZER;
+	uint32_t ret_orig;
+
+	assert((uintptr_t)o <= UINT32_MAX);
+	op.params[0].value.a = (uint32_t)(uintptr_t)o;
+
+	op.params[1].memref.parent = shm;
+	op.params[1].memref.offset = 0;
+	op.params[1].memref.size = blen;
+
+	op.paramTypes = TEEC_PARAM_TYPES(TEEC_VALUE_INPUT,
+					 TEEC_MEMREF_PARTIAL_INPUT, TEEC_NONE,
+					 TEEC_NONE);
+
+	res = TEEC_InvokeCommand(s, TA_CRYPT_CMD_POPULATE_TRANSIENT_OBJECT, &op,
+				 &ret_orig);
+
+	if (res != TEEC_SUCCESS && res != TEEC_ERROR_TARGET_DEAD) {
+		(void)ADBG_EXPECT_TEEC_ERROR_ORIGIN(c, TEEC_ORIGIN_TRUSTED_APP,
+						    ret_orig);
+	}
+
+	return res;
+}
+
 TEE_Result ta_crypt_cmd_set_operation_key(ADBG_Case_t *c, TEEC_Session *s,
 					  TEE_OperationHandle oph,
 					  TEE_ObjectHandle key)
@@ -381,3 +941,74 @@ TEEC_Result ta_crypt_cmd_free_operation(ADBG_Case_t *c, TEEC_Session *s,
 
 	return res;
 }
+
+TEEC_Result ta_crypt_cmd_sha2_init(ADBG_Case_t *c, TEEC_Session *s,
+				   uint32_t algo)
+{
+	TEEC_Result res;
+	TEEC_Operation op = TEEC_OPERATION_INITIALIZER;
+	uint32_t ret_orig;
+
+	op.params[0].value.a = algo;
+
+	op.paramTypes = TEEC_PARAM_TYPES(TEEC_VALUE_INPUT, TEEC_NONE, TEEC_NONE,
+					 TEEC_NONE);
+
+	res = TEEC_InvokeCommand(s, TA_CRYPT_CMD_SHA2_INIT, &op, &ret_orig);
+
+	if (res != TEEC_SUCCESS) {
+		(void)ADBG_EXPECT_TEEC_ERROR_ORIGIN(c, TEEC_ORIGIN_TRUSTED_APP,
+						    ret_orig);
+	}
+
+	return res;
+}
+
+TEEC_Result ta_crypt_cmd_sha2_update(ADBG_Case_t *c, TEEC_Session *s,
+				     TEEC_SharedMemory *shm, size_t offs,
+				     size_t size)
+{
+	TEEC_Result res;
+	TEEC_Operation op = TEEC_OPERATION_INITIALIZER;
+	uint32_t ret_orig;
+
+	op.params[0].memref.parent = shm;
+	op.params[0].memref.offset = offs;
+	op.params[0].memref.size = size;
+
+	op.paramTypes = TEEC_PARAM_TYPES(TEEC_MEMREF_PARTIAL_INPUT, TEEC_NONE,
+					 TEEC_NONE, TEEC_NONE);
+
+	res = TEEC_InvokeCommand(s, TA_CRYPT_CMD_SHA2_UPDATE, &op, &ret_orig);
+
+	if (res != TEEC_SUCCESS) {
+		(void)ADBG_EXPECT_TEEC_ERROR_ORIGIN(c, TEEC_ORIGIN_TRUSTED_APP,
+						    ret_orig);
+	}
+
+	return res;
+}
+
+TEEC_Result ta_crypt_cmd_sha2_final(ADBG_Case_t *c, TEEC_Session *s,
+				    void *digest, size_t *dlen)
+{
+	TEEC_Result res;
+	TEEC_Operation op = TEEC_OPERATION_INITIALIZER;
+	uint32_t ret_orig;
+
+	op.params[0].tmpref.buffer = digest;
+	op.params[0].tmpref.size = *dlen;
+
+	op.paramTypes = TEEC_PARAM_TYPES(TEEC_MEMREF_TEMP_OUTPUT, TEEC_NONE,
+					 TEEC_NONE, TEEC_NONE);
+
+	res = TEEC_InvokeCommand(s, TA_CRYPT_CMD_SHA2_FINAL, &op, &ret_orig);
+
+	if (res != TEEC_SUCCESS) {
+		(void)ADBG_EXPECT_TEEC_ERROR_ORIGIN(c, TEEC_ORIGIN_TRUSTED_APP,
+						    ret_orig);
+	}
+
+	*dlen = op.params[0].tmpref.size;
+	return res;
+}
@@ -39,8 +39,41 @@ TEEC_Result xtest_teec_open_static_session(TEEC_Session *session,
 					   TEEC_Operation *op,
 					   uint32_t *ret_orig);
 
+/* Set by --reuse-sessions */
+extern bool xtest_reuse_sessions;
+
+/*
+ * Leases a session for a case that doesn't depend on fresh TA state.
+ * With xtest_reuse_sessions set the session comes from a pool kept in
+ * the suite data, so the TA isn't loaded and the session set up again
+ * for each case, else it's simply opened. Hand it back with
+ * xtest_teec_release_session() instead of closing it, a session of a
+ * case that has failed or on which an invoke returned
+ * TEEC_ERROR_TARGET_DEAD is closed rather than reused. Only the suite
+ * process pools sessions, cases run in forked jobs open their own.
+ */
+TEEC_Result xtest_teec_lease_session(ADBG_Case_t *c, TEEC_Session *session,
+				     const TEEC_UUID *uuid,
+				     uint32_t *ret_orig);
+void xtest_teec_release_session(ADBG_Case_t *c, TEEC_Session *session);
+
+/* CleanupSuite_fp of the suites, logs what the pool saved and empties it */
+void xtest_session_pool_cleanup(ADBG_SuiteData_t *suite_data);
+
 #define TEEC_OPERATION_INITIALIZER { 0 }
 
+/*
+ * xtest is linked with -Wl,--wrap=TEEC_InvokeCommand so that every
+ * command goes through __wrap_TEEC_InvokeCommand(), which lets the
+ * watchdog of Do_ADBG_SetWatchdog() cancel it with
+ * xtest_teec_cancel_invoke().
+ */
+TEEC_Result __wrap_TEEC_InvokeCommand(TEEC_Session *session, uint32_t cmd,
+				      TEEC_Operation *op, uint32_t *ret_orig);
+TEEC_Result __real_TEEC_InvokeCommand(TEEC_Session *session, uint32_t cmd,
+				      TEEC_Operation *op, uint32_t *ret_orig);
+void xtest_teec_cancel_invoke(void *op);
+
 /* IO access macro */
 #define  IO(addr)  (*((volatile unsigned long *)(addr)))
 
@@ -92,6 +125,72 @@ TEEC_Result ta_crypt_cmd_free_operation(ADBG_Case_t *c,
 					       TEEC_Session *s,
 					       TEE_OperationHandle oph);
 
+TEEC_Result ta_crypt_cmd_sha2_init(ADBG_Case_t *c, TEEC_Session *s,
+				   uint32_t algo);
+TEEC_Result ta_crypt_cmd_sha2_update(ADBG_Case_t *c, TEEC_Session *s,
+				     TEEC_SharedMemory *shm, size_t offs,
+				     size_t size);
+TEEC_Result ta_crypt_cmd_sha2_final(ADBG_Case_t *c, TEEC_Session *s,
+				    void *digest, size_t *dlen);
+
+/*
+ * Builder for TA_CRYPT_CMD_BATCH, collects sub-commands on the host and
+ * runs them all with a single TEEC_InvokeCommand():
+ *
+ *	xtest_batch_init(&b);
+ *	n = xtest_batch_add(&b, TA_CRYPT_CMD_..., TEEC_PARAM_TYPES(...));
+ *	xtest_batch_value(&b, n, 0, a, b);
+ *	xtest_batch_ref(&b, n, 1, 0, earlier_n, 0, 0);
+ *	...
+ *	res = xtest_batch_invoke(c, s, &b);
+ *	xtest_batch_free(&b);
+ *
+ * Errors while building are remembered and returned by
+ * xtest_batch_invoke(). The parameter types are given as for
+ * TEEC_InvokeCommand() with TEEC_MEMREF_TEMP_* for memrefs. Output memrefs
+ * are copied back to the caller's buffers for each sub-command that
+ * succeeded.
+ */
+struct ta_crypt_batch_cmd;
+
+struct xtest_batch_out {
+	size_t cmd;
+	size_t param;
+	void *buf;
+	size_t *len;
+};
+
+struct xtest_batch {
+	struct ta_crypt_batch_cmd *cmds;
+	size_t num_cmds;
+	uint8_t *data;
+	size_t data_len;
+	struct xtest_batch_out *outs;
+	size_t num_outs;
+	size_t num_done;	/* successful sub-commands after invoke */
+	TEEC_Result res;
+};
+
+void xtest_batch_init(struct xtest_batch *b);
+void xtest_batch_free(struct xtest_batch *b);
+size_t xtest_batch_add(struct xtest_batch *b, uint32_t cmd_id,
+		       uint32_t param_types);
+void xtest_batch_value(struct xtest_batch *b, size_t cmd, size_t param,
+		       uint32_t a, uint32_t val_b);
+void xtest_batch_ref(struct xtest_batch *b, size_t cmd, size_t param,
+		     size_t field, size_t src_cmd, size_t src_param,
+		     size_t src_field);
+void xtest_batch_memref_in(struct xtest_batch *b, size_t cmd, size_t param,
+			   const void *buf, size_t len);
+void xtest_batch_memref_out(struct xtest_batch *b, size_t cmd, size_t param,
+			    void *buf, size_t *len);
+void xtest_batch_attrs(struct xtest_batch *b, size_t cmd, size_t param,
+		       const TEE_Attribute *attrs, uint32_t attr_count);
+void xtest_batch_get_value(struct xtest_batch *b, size_t cmd, size_t param,
+			   uint32_t *a, uint32_t *val_b);
+TEEC_Result xtest_batch_invoke(ADBG_Case_t *c, TEEC_Session *s,
+			       struct xtest_batch *b);
+
 void xtest_add_attr(size_t *attr_count, TEE_Attribute *attrs,
 			   uint32_t attr_id, const void *buf, size_t len);
 void xtest_add_attr_value(size_t *attr_count, TEE_Attribute *attrs,
@@ -99,5 +198,24 @@ void xtest_add_attr_value(size_t *attr_count, TEE_Attribute *attrs,
 
 TEE_Result pack_attrs(const TEE_Attribute *attrs, uint32_t attr_count,
 			     uint8_t **buf, size_t *blen);
+size_t packed_attrs_size(const TEE_Attribute *attrs, uint32_t attr_count);
+void pack_attrs_into(const TEE_Attribute *attrs, uint32_t attr_count,
+		     uint8_t *buf, size_t blen);
+
+/*
+ * Packs attributes straight into a registered shared memory region which
+ * is kept between calls and only reallocated when it's too small. Start
+ * with a zeroed shm and release it with TEEC_ReleaseSharedMemory() when
+ * done. The TA parses the attributes in place, so populating a key this
+ * way doesn't copy or allocate anything per call.
+ */
+TEEC_Result xtest_pack_attrs_shm(TEEC_SharedMemory *shm,
+				 const TEE_Attribute *attrs,
+				 uint32_t attr_count, size_t *blen);
+TEEC_Result ta_crypt_cmd_populate_transient_object_shm(ADBG_Case_t *c,
+						       TEEC_Session *s,
+						       TEE_ObjectHandle o,
+						       TEEC_SharedMemory *shm,
+						       size_t blen);
 
 #endif /*XTEST_HELPERS_H*/
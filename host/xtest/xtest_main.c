@@ -11,6 +11,9 @@
  * GNU General Public License for more details.
  */
 
+#include <ctype.h>
+#include <errno.h>
+#include <getopt.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -19,6 +22,8 @@
 #include <adbg.h>
 #include "xtest_test.h"
 #include "xtest_helpers.h"
+#include "xtest_rsp.h"
+#include "xtest_vectors.h"
 #ifdef WITH_GP_TESTS
 #include "adbg_entry_declare.h"
 #endif
@@ -26,13 +31,13 @@
 ADBG_SUITE_DECLARE(XTEST_TEE_TEST)
 
 /*ADBG Suite definition.*/
-ADBG_SUITE_DEFINE_BEGIN(XTEST_TEE_TEST, NULL)
+ADBG_SUITE_DEFINE_BEGIN(XTEST_TEE_TEST, xtest_session_pool_cleanup)
 ADBG_SUITE_ENTRY(XTEST_TEE_1001, NULL)
 ADBG_SUITE_ENTRY(XTEST_TEE_1004, NULL)
 ADBG_SUITE_ENTRY(XTEST_TEE_1005, NULL)
 ADBG_SUITE_ENTRY(XTEST_TEE_1006, NULL)
 ADBG_SUITE_ENTRY(XTEST_TEE_1007, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_1008, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_1008, NULL)
 ADBG_SUITE_ENTRY(XTEST_TEE_1009, NULL)
 ADBG_SUITE_ENTRY(XTEST_TEE_1010, NULL)
 ADBG_SUITE_ENTRY(XTEST_TEE_1011, NULL)
@@ -51,22 +56,22 @@ ADBG_SUITE_ENTRY(XTEST_TEE_4009, NULL)
 ADBG_SUITE_ENTRY(XTEST_TEE_4010, NULL)
 /* FVP    ADBG_SUITE_ENTRY(XTEST_TEE_5006, NULL) */
 #ifdef USER_SPACE
-ADBG_SUITE_ENTRY(XTEST_TEE_6001, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_6002, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_6003, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_6004, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_6005, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_6006, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_6007, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_6008, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_6009, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_6001, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_6002, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_6003, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_6004, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_6005, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_6006, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_6007, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_6008, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_6009, NULL)
 #ifdef WITH_GP_TESTS
-ADBG_SUITE_ENTRY(XTEST_TEE_6010, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_6011, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_6010, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_6011, NULL)
 #endif
-ADBG_SUITE_ENTRY(XTEST_TEE_6012, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_6013, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_6014, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_6012, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_6013, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_6014, NULL)
 ADBG_SUITE_ENTRY(XTEST_TEE_7001, NULL)
 /* FVP    ADBG_SUITE_ENTRY(XTEST_TEE_7002, NULL) */
 ADBG_SUITE_ENTRY(XTEST_TEE_7003, NULL)
@@ -90,20 +95,20 @@ ADBG_ENTRY_AUTO_GENERATED_TESTS()
 ADBG_SUITE_ENTRY(XTEST_TEE_10001, NULL)
 ADBG_SUITE_ENTRY(XTEST_TEE_10002, NULL)
 #if defined(CFG_ENC_FS) && defined(CFG_REE_FS)
-ADBG_SUITE_ENTRY(XTEST_TEE_20001, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_20002, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_20003, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_20004, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_20021, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_20022, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_20023, NULL)
-
-ADBG_SUITE_ENTRY(XTEST_TEE_20501, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_20502, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_20503, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_20521, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_20522, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_20523, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_20001, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_20002, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_20003, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_20004, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_20021, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_20022, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_20023, NULL)
+
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_20501, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_20502, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_20503, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_20521, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_20522, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_20523, NULL)
 #endif /* defined(CFG_ENC_FS) && defined(CFG_REE_FS) */
 
 ADBG_SUITE_DEFINE_END()
@@ -111,32 +116,206 @@ ADBG_SUITE_DEFINE_END()
 
 ADBG_SUITE_DECLARE(XTEST_TEE_BENCHMARK)
 
-ADBG_SUITE_DEFINE_BEGIN(XTEST_TEE_BENCHMARK, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_BENCHMARK_1001, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_BENCHMARK_1002, NULL)
-ADBG_SUITE_ENTRY(XTEST_TEE_BENCHMARK_1003, NULL)
+ADBG_SUITE_DEFINE_BEGIN(XTEST_TEE_BENCHMARK, xtest_session_pool_cleanup)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_BENCHMARK_1001, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_BENCHMARK_1002, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_BENCHMARK_1003, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_BENCHMARK_2001, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_BENCHMARK_2002, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_BENCHMARK_2003, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_BENCHMARK_2004, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_BENCHMARK_2005, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_BENCHMARK_2006, NULL)
+ADBG_SUITE_ENTRY_SERIAL(XTEST_TEE_BENCHMARK_2007, NULL)
 ADBG_SUITE_DEFINE_END()
 
 char *_device = NULL;
+/* All devices given with -d, forked jobs are spread over them */
+static char **devices;
+static size_t num_devices;
 unsigned int level = 0;
 static const char glevel[] = "0";
 static const char gsuitename[] = "regression";
 
+/* Upper bounds of -j and -w, far beyond what a TEE runs in parallel */
+#define XTEST_MAX_JOBS		256
+#define XTEST_MAX_WORKERS	64
+
+/* Upper bound of --repeat */
+#define XTEST_MAX_REPEAT	1000000
+
+/* Upper bound of the shard count of -s */
+#define XTEST_MAX_SHARDS	1000000
+
+/* Upper bound of -b in kbytes, the largest ring ADBG allocates */
+#define XTEST_MAX_LOG_KB	(1024 * 1024)
+
 void usage(char *program);
 
+/*
+ * A forked case process needs its own TEE context. It runs a single case
+ * so it has nothing to gain from the session pool, whose sessions belong
+ * to the context of the suite process.
+ */
+static void fork_init(size_t slot)
+{
+	if (num_devices > 1)
+		_device = devices[slot % num_devices];
+	xtest_teec_ctx_deinit();
+	xtest_teec_ctx_init();
+	xtest_reuse_sessions = false;
+}
+
 void usage(char *program)
 {
 	printf("Usage: %s <options> <test_id>\n", program);
 	printf("\n");
 	printf("options:\n");
+	printf("\t-b <kbytes>        buffer the log, written by a thread\n");
 	printf("\t-d <device-type>   default not set, use any\n");
+	printf("\t                   repeat to run cases on several devices\n");
+	printf("\t                   at the same time, one job per device\n");
+	printf("\t-j <jobs>          cases to run in parallel processes, default 1\n");
 	printf("\t-l <level>         test suite level: [0-15]\n");
+	printf("\t-r <format>:<file> write a junit or json report to file\n");
+	printf("\t-s, --shard <i>/<n> only run shard i of n, 0 <= i < n\n");
+	printf("\t--collapse         drop passing subcases from the results\n");
+	printf("\t                   to bound memory use\n");
+	printf("\t--durations <file> keep the duration of each case in file\n");
+	printf("\t--repeat <n>       run the selected cases n times\n");
+	printf("\t--duration <time>  repeat the selected cases for time\n");
+	printf("\t                   seconds, or with suffix m, h or d\n");
+	printf("\t--budget <time>    only run the cases expected to fit in\n");
+	printf("\t                   the time, seconds or with suffix m, h\n");
+	printf("\t                   or d, needs --durations\n");
+	printf("\t--reuse-sessions   let cases share TA sessions\n");
+	printf("\t--rng-sizes <list> request sizes of benchmark 2007 in bytes,\n");
+	printf("\t                   comma separated, up to 16 of 1MB or less\n");
+	printf("\t--timeout <time>   time out cases running longer\n");
+	printf("\t--invoke-timeout <time>\n");
+	printf("\t                   time out cases with a command running\n");
+	printf("\t                   longer, commands are cancelled\n");
+	printf("\t-v <dir>           NIST test vector files, default %s\n",
+	       xtest_vector_dir);
+	printf("\t-w <workers>       worker threads for test vectors, default 1\n");
 	printf("\t-t <test_suite>    available test suite: regression, benchmark\n");
 	printf("\t                   default value = %s\n", gsuitename);
 	printf("\t-h                 show usage\n");
 	printf("\n");
 }
 
+static bool add_device(char *dev)
+{
+	char **d = realloc(devices, (num_devices + 1) * sizeof(*d));
+
+	if (!d)
+		return false;
+	devices = d;
+	devices[num_devices++] = dev;
+	return true;
+}
+
+/* Parses a count in [min, max], signs and trailing characters are refused */
+static bool parse_count(const char *arg, unsigned long min, unsigned long max,
+			size_t *count)
+{
+	char *end;
+	unsigned long n;
+
+	if (!isdigit((unsigned char)*arg))
+		return false;
+	errno = 0;
+	n = strtoul(arg, &end, 0);
+	if (errno || *end || n < min || n > max)
+		return false;
+	*count = n;
+	return true;
+}
+
+/* Parses "<i>/<n>", 0 <= i < n <= XTEST_MAX_SHARDS */
+static bool set_shard(const char *arg)
+{
+	const char *sep = strchr(arg, '/');
+	char index[32];
+	size_t i;
+	size_t n;
+
+	if (!sep || (size_t)(sep - arg) >= sizeof(index))
+		return false;
+	memcpy(index, arg, sep - arg);
+	index[sep - arg] = '\0';
+	if (!parse_count(sep + 1, 1, XTEST_MAX_SHARDS, &n) ||
+	    !parse_count(index, 0, n - 1, &i))
+		return false;
+	Do_ADBG_SetShard(i, n);
+	return true;
+}
+
+/* Sets *v to v * m, returns false if it doesn't fit */
+static bool mul_u64(uint64_t *v, uint64_t m)
+{
+	if (*v > UINT64_MAX / m)
+		return false;
+	*v *= m;
+	return true;
+}
+
+/*
+ * Parses seconds, or minutes, hours or days with suffix m, h or d. Signs
+ * and times that don't fit in microseconds are refused.
+ */
+static bool parse_time(const char *arg, uint64_t *time_us)
+{
+	char *end;
+	uint64_t t;
+
+	if (!isdigit((unsigned char)*arg))
+		return false;
+	errno = 0;
+	t = strtoull(arg, &end, 0);
+	if (errno)
+		return false;
+
+	switch (*end) {
+	case 'd':
+		if (!mul_u64(&t, 24))
+			return false;
+		/* Fallthrough */
+	case 'h':
+		if (!mul_u64(&t, 60))
+			return false;
+		/* Fallthrough */
+	case 'm':
+		if (!mul_u64(&t, 60))
+			return false;
+		end++;
+		break;
+	case 's':
+		end++;
+		break;
+	default:
+		break;
+	}
+	if (*end || !mul_u64(&t, 1000000))
+		return false;
+	*time_us = t;
+	return true;
+}
+
+/* Parses "<format>:<file>" */
+static bool add_report(char *arg)
+{
+	char *sep = strchr(arg, ':');
+	bool ret;
+
+	if (!sep)
+		return false;
+	*sep = '\0';
+	ret = Do_ADBG_AddReport(arg, sep + 1);
+	*sep = ':';
+	return ret;
+}
+
 int main(int argc, char *argv[])
 {
 	int opt;
@@ -144,20 +323,156 @@ int main(int argc, char *argv[])
 	int ret;
 	char *p = (char *)glevel;
 	char *test_suite = (char *)gsuitename;
+	size_t num_jobs = 1;
+	size_t count;
+	size_t n;
+	bool have_budget = false;
+	bool have_durations = false;
+	size_t repeat = 0;
+	uint64_t duration = 0;
+	uint64_t budget;
+	uint64_t case_timeout = 0;
+	uint64_t invoke_timeout = 0;
+	enum {
+		OPT_BUDGET = 256, OPT_COLLAPSE, OPT_DURATION, OPT_DURATIONS,
+		OPT_INVOKE_TIMEOUT, OPT_REPEAT, OPT_REUSE_SESSIONS,
+		OPT_RNG_SIZES, OPT_TIMEOUT
+	};
+	static const struct option long_opts[] = {
+		{ "budget", required_argument, NULL, OPT_BUDGET },
+		{ "collapse", no_argument, NULL, OPT_COLLAPSE },
+		{ "duration", required_argument, NULL, OPT_DURATION },
+		{ "durations", required_argument, NULL, OPT_DURATIONS },
+		{ "invoke-timeout", required_argument, NULL,
+		  OPT_INVOKE_TIMEOUT },
+		{ "repeat", required_argument, NULL, OPT_REPEAT },
+		{ "reuse-sessions", no_argument, NULL, OPT_REUSE_SESSIONS },
+		{ "rng-sizes", required_argument, NULL, OPT_RNG_SIZES },
+		{ "shard", required_argument, NULL, 's' },
+		{ "timeout", required_argument, NULL, OPT_TIMEOUT },
+		{ NULL, 0, NULL, 0 }
+	};
 
 	opterr = 0;
 
-	while ((opt = getopt(argc, argv, "d:l:t:h")) != -1)
+	while ((opt = getopt_long(argc, argv, "b:d:j:l:r:s:t:v:w:h",
+				  long_opts, NULL)) != -1)
 		switch (opt) {
+		case 'b':
+			if (!parse_count(optarg, 0, XTEST_MAX_LOG_KB, &count)) {
+				fprintf(stderr, "Invalid log buffer %s, 0-%d\n",
+					optarg, XTEST_MAX_LOG_KB);
+				return -1;
+			}
+			if (!Do_ADBG_SetAsyncLog(count * 1024)) {
+				fprintf(stderr, "Cannot buffer the log\n");
+				return -1;
+			}
+			break;
 		case 'd':
-			_device = optarg;
+			if (!add_device(optarg))
+				return -1;
+			_device = devices[0];
+			break;
+		case 'j':
+			if (!parse_count(optarg, 1, XTEST_MAX_JOBS,
+					 &num_jobs)) {
+				fprintf(stderr, "Invalid jobs %s, 1-%d\n",
+					optarg, XTEST_MAX_JOBS);
+				return -1;
+			}
 			break;
 		case 'l':
 			p = optarg;
 			break;
+		case 'r':
+			if (!add_report(optarg)) {
+				fprintf(stderr, "Cannot write report %s\n",
+					optarg);
+				return -1;
+			}
+			break;
+		case 's':
+			if (!set_shard(optarg)) {
+				fprintf(stderr, "Invalid shard %s\n", optarg);
+				return -1;
+			}
+			break;
 		case 't':
 			test_suite = optarg;
 			break;
+		case 'v':
+			xtest_vector_dir = optarg;
+			break;
+		case 'w':
+			if (!parse_count(optarg, 1, XTEST_MAX_WORKERS,
+					 &count)) {
+				fprintf(stderr, "Invalid workers %s, 1-%d\n",
+					optarg, XTEST_MAX_WORKERS);
+				return -1;
+			}
+			xtest_num_workers = count;
+			break;
+		case OPT_BUDGET:
+			/* 0 would mean no budget at all */
+			if (!parse_time(optarg, &budget) || !budget) {
+				fprintf(stderr, "Invalid budget %s\n", optarg);
+				return -1;
+			}
+			Do_ADBG_SetBudget(budget);
+			have_budget = true;
+			break;
+		case OPT_COLLAPSE:
+			Do_ADBG_SetCollapsePassing(true);
+			break;
+		case OPT_DURATION:
+			if (!parse_time(optarg, &duration)) {
+				fprintf(stderr, "Invalid duration %s\n",
+					optarg);
+				return -1;
+			}
+			break;
+		case OPT_INVOKE_TIMEOUT:
+			if (!parse_time(optarg, &invoke_timeout) ||
+			    !invoke_timeout) {
+				fprintf(stderr, "Invalid invoke timeout %s\n",
+					optarg);
+				return -1;
+			}
+			break;
+		case OPT_REPEAT:
+			if (!parse_count(optarg, 1, XTEST_MAX_REPEAT,
+					 &repeat)) {
+				fprintf(stderr, "Invalid repeat %s, 1-%d\n",
+					optarg, XTEST_MAX_REPEAT);
+				return -1;
+			}
+			break;
+		case OPT_REUSE_SESSIONS:
+			xtest_reuse_sessions = true;
+			break;
+		case OPT_RNG_SIZES:
+			if (!xtest_benchmark_set_rng_sizes(optarg)) {
+				fprintf(stderr, "Invalid RNG sizes %s\n",
+					optarg);
+				return -1;
+			}
+			break;
+		case OPT_TIMEOUT:
+			if (!parse_time(optarg, &case_timeout) ||
+			    !case_timeout) {
+				fprintf(stderr, "Invalid timeout %s\n",
+					optarg);
+				return -1;
+			}
+			break;
+		case OPT_DURATIONS:
+			if (!Do_ADBG_SetDurationDB(optarg)) {
+				fprintf(stderr, "Cannot read %s\n", optarg);
+				return -1;
+			}
+			have_durations = true;
+			break;
 		case 'h':
 			usage(argv[0]);
 			return 0;
@@ -166,6 +481,31 @@ int main(int argc, char *argv[])
 			return -1;
  		}
 
+	if (have_budget && !have_durations) {
+		fprintf(stderr, "--budget needs --durations\n");
+		return -1;
+	}
+
+	Do_ADBG_SetRepeat(repeat, duration);
+	if (case_timeout || invoke_timeout)
+		Do_ADBG_SetWatchdog(case_timeout, invoke_timeout,
+				    xtest_teec_cancel_invoke);
+
+	/* Keep every device busy */
+	if (num_jobs < num_devices)
+		num_jobs = num_devices;
+	Do_ADBG_SetNumJobs(num_jobs, fork_init);
+	/* Job slot i runs on device i % num_devices, see fork_init() */
+	for (n = 0; num_devices > 1 && n < num_devices; n++)
+		Do_ADBG_Log("Device %zu: %s", n, devices[n]);
+	/* With a timeout every case runs in a forked job */
+	if (xtest_reuse_sessions && (case_timeout || invoke_timeout))
+		Do_ADBG_Log("Sessions aren't reused with a timeout, "
+			    "forked jobs open their own");
+	else if (xtest_reuse_sessions && num_jobs > 1)
+		Do_ADBG_Log("Sessions are only reused by the serial cases, "
+			    "forked jobs open their own");
+
 	for (index = optind; index < argc; index++)
 		printf("Test ID: %s\n", argv[index]);
 
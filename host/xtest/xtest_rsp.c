@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2015, Linaro Limited
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License Version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ */
+
+#include <ctype.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "xtest_rsp.h"
+
+#ifndef XTEST_VECTOR_DIR
+#define XTEST_VECTOR_DIR "/usr/share/xtest"
+#endif
+
+const char *xtest_vector_dir = XTEST_VECTOR_DIR;
+
+static size_t line_end(const struct xtest_rsp *rsp, size_t pos)
+{
+	const char *p = memchr(rsp->data + pos, '\n', rsp->size - pos);
+
+	if (!p)
+		return rsp->size;
+	return p - rsp->data + 1;
+}
+
+static bool line_is_blank(const char *p, const char *end)
+{
+	while (p < end && isspace((unsigned char)*p))
+		p++;
+	return p == end;
+}
+
+static bool add_vect(struct xtest_rsp *rsp, size_t sect, size_t start,
+		     size_t end)
+{
+	struct xtest_rsp_vect *v;
+
+	v = realloc(rsp->vects, (rsp->num_vects + 1) * sizeof(*v));
+	if (!v)
+		return false;
+	rsp->vects = v;
+	v += rsp->num_vects;
+	v->sect = sect;
+	v->start = start;
+	v->end = end;
+	rsp->num_vects++;
+	return true;
+}
+
+/*
+ * A vector is a run of "key = value" lines ended by a blank line, a
+ * section header or the end of the file. Comment lines start with '#'.
+ */
+static bool index_vects(struct xtest_rsp *rsp)
+{
+	size_t pos = 0;
+	size_t sect = 0;
+	size_t start = 0;
+	bool in_vect = false;
+
+	while (pos < rsp->size) {
+		size_t next = line_end(rsp, pos);
+		const char *p = rsp->data + pos;
+
+		if (*p == '#') {
+			pos = next;
+			continue;
+		}
+
+		if (*p == '[' || line_is_blank(p, rsp->data + next)) {
+			if (in_vect && !add_vect(rsp, sect, start, pos))
+				return false;
+			in_vect = false;
+			if (*p == '[')
+				sect = pos;
+		} else if (!in_vect) {
+			in_vect = true;
+			start = pos;
+		}
+		pos = next;
+	}
+
+	if (in_vect)
+		return add_vect(rsp, sect, start, pos);
+	return true;
+}
+
+bool xtest_rsp_available(const char *name)
+{
+	char path[PATH_MAX];
+
+	snprintf(path, sizeof(path), "%s/%s", xtest_vector_dir, name);
+	return access(path, F_OK) == 0;
+}
+
+bool xtest_rsp_open(struct xtest_rsp *rsp, const char *name)
+{
+	char path[PATH_MAX];
+	struct stat st;
+	void *data;
+	int fd;
+
+	memset(rsp, 0, sizeof(*rsp));
+	snprintf(path, sizeof(path), "%s/%s", xtest_vector_dir, name);
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		fprintf(stderr, "Cannot open %s\n", path);
+		return false;
+	}
+	if (fstat(fd, &st) || !st.st_size) {
+		close(fd);
+		return false;
+	}
+	data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED)
+		return false;
+
+	rsp->data = data;
+	rsp->size = st.st_size;
+	if (!index_vects(rsp)) {
+		xtest_rsp_close(rsp);
+		return false;
+	}
+	return true;
+}
+
+void xtest_rsp_close(struct xtest_rsp *rsp)
+{
+	if (rsp->data)
+		munmap((void *)rsp->data, rsp->size);
+	free(rsp->vects);
+	memset(rsp, 0, sizeof(*rsp));
+}
+
+bool xtest_rsp_in_section(const struct xtest_rsp *rsp, size_t n,
+			  const char *sect)
+{
+	size_t len = strlen(sect);
+	const char *p;
+
+	if (n >= rsp->num_vects)
+		return false;
+	p = rsp->data + rsp->vects[n].sect;
+	if (*p != '[' || rsp->vects[n].sect + len + 2 > rsp->size)
+		return false;
+	return !memcmp(p + 1, sect, len) && p[len + 1] == ']';
+}
+
+/* Finds "key = value" in vector n and returns the value and its length */
+static const char *find_value(const struct xtest_rsp *rsp, size_t n,
+			      const char *key, size_t *len)
+{
+	size_t key_len = strlen(key);
+	size_t pos;
+	size_t end;
+
+	if (n >= rsp->num_vects)
+		return NULL;
+
+	pos = rsp->vects[n].start;
+	end = rsp->vects[n].end;
+	while (pos < end) {
+		size_t next = line_end(rsp, pos);
+		const char *p = rsp->data + pos;
+		const char *e = rsp->data + next;
+
+		pos = next;
+		if ((size_t)(e - p) <= key_len || memcmp(p, key, key_len))
+			continue;
+		p += key_len;
+		while (p < e && (*p == ' ' || *p == '\t'))
+			p++;
+		if (p == e || *p != '=')
+			continue;
+		p++;
+		while (p < e && (*p == ' ' || *p == '\t'))
+			p++;
+		while (e > p && isspace((unsigned char)e[-1]))
+			e--;
+		*len = e - p;
+		return p;
+	}
+	return NULL;
+}
+
+bool xtest_rsp_has_key(const struct xtest_rsp *rsp, size_t n,
+		       const char *key)
+{
+	size_t len;
+
+	return find_value(rsp, n, key, &len) != NULL;
+}
+
+bool xtest_rsp_get_uint(const struct xtest_rsp *rsp, size_t n,
+			const char *key, unsigned long *val)
+{
+	const char *p;
+	size_t len;
+	size_t i;
+
+	p = find_value(rsp, n, key, &len);
+	if (!p || !len)
+		return false;
+
+	*val = 0;
+	for (i = 0; i < len; i++) {
+		if (!isdigit((unsigned char)p[i]))
+			return false;
+		*val = *val * 10 + p[i] - '0';
+	}
+	return true;
+}
+
+static int hex_nibble(char c)
+{
+	if (c >= '0' && c <= '9')
+		return c - '0';
+	if (c >= 'a' && c <= 'f')
+		return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F')
+		return c - 'A' + 10;
+	return -1;
+}
+
+bool xtest_rsp_get_bin(const struct xtest_rsp *rsp, size_t n,
+		       const char *key, uint8_t *buf, size_t *len)
+{
+	const char *p;
+	size_t hex_len;
+	size_t i;
+
+	p = find_value(rsp, n, key, &hex_len);
+	if (!p || (hex_len % 2) || hex_len / 2 > *len)
+		return false;
+
+	for (i = 0; i < hex_len / 2; i++) {
+		int hi = hex_nibble(p[2 * i]);
+		int lo = hex_nibble(p[2 * i + 1]);
+
+		if (hi < 0 || lo < 0)
+			return false;
+		buf[i] = (hi << 4) | lo;
+	}
+	*len = hex_len / 2;
+	return true;
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2015, Linaro Limited
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License Version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ */
+
+#ifndef XTEST_RSP_H
+#define XTEST_RSP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Directory holding the NIST CAVP vector files, set with -v */
+extern const char *xtest_vector_dir;
+
+struct xtest_rsp_vect {
+	size_t sect;	/* offset of the "[...]" header, or of the vector */
+	size_t start;	/* offset of the first "key = value" line */
+	size_t end;	/* offset just past the last line */
+};
+
+/*
+ * A CAVP response (.rsp) file, mapped read-only. Opening the file only
+ * indexes where each vector starts and ends, the values are decoded when
+ * asked for so a vector costs nothing until the test gets to it.
+ */
+struct xtest_rsp {
+	const char *data;
+	size_t size;
+	struct xtest_rsp_vect *vects;
+	size_t num_vects;
+};
+
+/*
+ * Returns false if the file isn't in xtest_vector_dir, the cases using
+ * it are then skipped rather than failed
+ */
+bool xtest_rsp_available(const char *name);
+bool xtest_rsp_open(struct xtest_rsp *rsp, const char *name);
+void xtest_rsp_close(struct xtest_rsp *rsp);
+
+/* Returns true if vector n is in the section "[sect]" */
+bool xtest_rsp_in_section(const struct xtest_rsp *rsp, size_t n,
+			  const char *sect);
+/* Returns true if vector n has a value for key, without decoding it */
+bool xtest_rsp_has_key(const struct xtest_rsp *rsp, size_t n,
+		       const char *key);
+bool xtest_rsp_get_uint(const struct xtest_rsp *rsp, size_t n,
+			const char *key, unsigned long *val);
+/* Decodes the hex value of key, *len is buffer size in, value size out */
+bool xtest_rsp_get_bin(const struct xtest_rsp *rsp, size_t n,
+		       const char *key, uint8_t *buf, size_t *len);
+
+#endif /*XTEST_RSP_H*/
@@ -101,6 +101,19 @@ ADBG_CASE_DECLARE(XTEST_TEE_20523);
 ADBG_CASE_DECLARE(XTEST_TEE_BENCHMARK_1001);
 ADBG_CASE_DECLARE(XTEST_TEE_BENCHMARK_1002);
 ADBG_CASE_DECLARE(XTEST_TEE_BENCHMARK_1003);
+ADBG_CASE_DECLARE(XTEST_TEE_BENCHMARK_2001);
+ADBG_CASE_DECLARE(XTEST_TEE_BENCHMARK_2002);
+ADBG_CASE_DECLARE(XTEST_TEE_BENCHMARK_2003);
+ADBG_CASE_DECLARE(XTEST_TEE_BENCHMARK_2004);
+ADBG_CASE_DECLARE(XTEST_TEE_BENCHMARK_2005);
+ADBG_CASE_DECLARE(XTEST_TEE_BENCHMARK_2006);
+ADBG_CASE_DECLARE(XTEST_TEE_BENCHMARK_2007);
+
+/*
+ * Sets the request sizes of XTEST_TEE_BENCHMARK_2007 from a comma separated
+ * list of at most 16 sizes of 1MB or less. Returns false if arg is invalid.
+ */
+bool xtest_benchmark_set_rng_sizes(const char *arg);
 
 #ifdef WITH_GP_TESTS
 #include "adbg_case_declare.h"
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2015, Linaro Limited
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License Version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ */
+
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "xtest_test.h"
+#include "xtest_helpers.h"
+#include "xtest_vectors.h"
+
+#define VECTOR_TITLE_LEN 80
+
+unsigned int xtest_num_workers = 1;
+
+struct vector_run {
+	ADBG_Case_t *c;
+	const struct xtest_vector_ops *ops;
+	pthread_mutex_t mu;
+	pthread_cond_t cond;
+	size_t next;
+	/* Detached case of each vector, valid when done[n] is set */
+	ADBG_Case_t **results;
+	bool *done;
+};
+
+struct vector_worker {
+	struct vector_run *run;
+	pthread_t thr;
+	TEEC_Session session;
+	void *priv;
+};
+
+static bool open_worker(ADBG_Case_t *c, const TEEC_UUID *uuid,
+			const struct xtest_vector_ops *ops,
+			TEEC_Session *s, void **priv)
+{
+	uint32_t ret_orig;
+
+	*priv = NULL;
+	if (!ADBG_EXPECT_TEEC_SUCCESS(c,
+		xtest_teec_lease_session(c, s, uuid, &ret_orig)))
+		return false;
+
+	if (ops->worker_init && !ops->worker_init(c, s, priv)) {
+		xtest_teec_release_session(c, s);
+		return false;
+	}
+
+	return true;
+}
+
+static void close_worker(ADBG_Case_t *c, const struct xtest_vector_ops *ops,
+			 TEEC_Session *s, void *priv)
+{
+	if (ops->worker_fini)
+		ops->worker_fini(c, s, priv);
+	xtest_teec_release_session(c, s);
+}
+
+static void run_vectors_serial(ADBG_Case_t *c, const TEEC_UUID *uuid,
+			       const struct xtest_vector_ops *ops)
+{
+	char title[VECTOR_TITLE_LEN];
+	TEEC_Session session = { 0 };
+	void *priv;
+	size_t n;
+
+	if (!open_worker(c, uuid, ops, &session, &priv))
+		return;
+
+	for (n = 0; n < ops->num_vectors; n++) {
+		if (!ops->title(n, title, sizeof(title)))
+			continue;
+		Do_ADBG_BeginSubCase(c, "%s", title);
+		ops->run(c, &session, priv, n);
+		Do_ADBG_EndSubCase(c, "%s", title);
+	}
+
+	close_worker(c, ops, &session, priv);
+}
+
+static void *vector_worker(void *arg)
+{
+	struct vector_worker *w = arg;
+	struct vector_run *r = w->run;
+	char title[VECTOR_TITLE_LEN];
+	ADBG_Case_t *d;
+	size_t n;
+
+	while (true) {
+		pthread_mutex_lock(&r->mu);
+		n = r->next++;
+		pthread_mutex_unlock(&r->mu);
+
+		if (n >= r->ops->num_vectors)
+			break;
+		if (!r->ops->title(n, title, sizeof(title)))
+			continue;
+
+		/* A NULL result is reported as a failure when merged */
+		d = Do_ADBG_BeginDetachedCase(r->c);
+		if (d) {
+			r->ops->run(d, &w->session, w->priv, n);
+			Do_ADBG_EndDetachedCase(d);
+		}
+
+		pthread_mutex_lock(&r->mu);
+		r->results[n] = d;
+		r->done[n] = true;
+		pthread_cond_broadcast(&r->cond);
+		pthread_mutex_unlock(&r->mu);
+	}
+
+	return NULL;
+}
+
+void xtest_run_vectors(ADBG_Case_t *c, const TEEC_UUID *uuid,
+		       const struct xtest_vector_ops *ops)
+{
+	size_t num_workers = xtest_num_workers;
+	struct vector_worker *workers = NULL;
+	struct vector_run r;
+	char title[VECTOR_TITLE_LEN];
+	size_t num_opened = 0;
+	size_t num_started = 0;
+	size_t n;
+
+	if (num_workers <= 1) {
+		run_vectors_serial(c, uuid, ops);
+		return;
+	}
+
+	memset(&r, 0, sizeof(r));
+	r.c = c;
+	r.ops = ops;
+	pthread_mutex_init(&r.mu, NULL);
+	pthread_cond_init(&r.cond, NULL);
+	r.results = calloc(ops->num_vectors, sizeof(*r.results));
+	r.done = calloc(ops->num_vectors, sizeof(*r.done));
+	workers = calloc(num_workers, sizeof(*workers));
+	if (!ADBG_EXPECT_NOT_NULL(c, r.results) ||
+	    !ADBG_EXPECT_NOT_NULL(c, r.done) ||
+	    !ADBG_EXPECT_NOT_NULL(c, workers))
+		goto out;
+
+	/* Sessions and worker state are set up here, where c may be used */
+	for (num_opened = 0; num_opened < num_workers; num_opened++) {
+		struct vector_worker *w = workers + num_opened;
+
+		w->run = &r;
+		if (!open_worker(c, uuid, ops, &w->session, &w->priv))
+			break;
+	}
+
+	for (num_started = 0; num_started < num_opened; num_started++) {
+		struct vector_worker *w = workers + num_started;
+
+		if (!ADBG_EXPECT(c, 0, pthread_create(&w->thr, NULL,
+						      vector_worker, w)))
+			break;
+	}
+	if (!num_started)
+		goto out_close;
+
+	for (n = 0; n < ops->num_vectors; n++) {
+		if (!ops->title(n, title, sizeof(title)))
+			continue;
+
+		pthread_mutex_lock(&r.mu);
+		while (!r.done[n])
+			pthread_cond_wait(&r.cond, &r.mu);
+		pthread_mutex_unlock(&r.mu);
+
+		Do_ADBG_BeginSubCase(c, "%s", title);
+		if (r.results[n])
+			Do_ADBG_MergeDetachedCase(c, r.results[n]);
+		else
+			ADBG_EXPECT_NOT_NULL(c, r.results[n]);
+		Do_ADBG_EndSubCase(c, "%s", title);
+	}
+
+	for (n = 0; n < num_started; n++)
+		pthread_join(workers[n].thr, NULL);
+out_close:
+	for (n = 0; n < num_opened; n++)
+		close_worker(c, ops, &workers[n].session, workers[n].priv);
+out:
+	free(workers);
+	free(r.done);
+	free(r.results);
+	pthread_cond_destroy(&r.cond);
+	pthread_mutex_destroy(&r.mu);
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2015, Linaro Limited
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License Version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ */
+
+
+#ifndef XTEST_VECTORS_H
+#define XTEST_VECTORS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <tee_client_api.h>
+#include <adbg.h>
+
+/* Number of worker threads xtest_run_vectors() uses, set with -w */
+extern unsigned int xtest_num_workers;
+
+struct xtest_vector_ops {
+	size_t num_vectors;
+	/*
+	 * Formats the subcase title of vector n, returns false if the
+	 * vector is to be skipped. Called from any thread.
+	 */
+	bool (*title)(size_t n, char *buf, size_t len);
+	/*
+	 * Optional, called on the calling thread to set up and tear down
+	 * the private state of each worker.
+	 */
+	bool (*worker_init)(ADBG_Case_t *c, TEEC_Session *s, void **priv);
+	void (*worker_fini)(ADBG_Case_t *c, TEEC_Session *s, void *priv);
+	/* Runs vector n, on a worker thread c is a detached case */
+	void (*run)(ADBG_Case_t *c, TEEC_Session *s, void *priv, size_t n);
+};
+
+/*
+ * Runs independent test vectors, each as a subcase of c. With more than
+ * one worker the vectors are spread over xtest_num_workers threads, each
+ * with its own session to uuid. The subcases are still reported in
+ * vector order, with the log output of each vector kept together.
+ */
+void xtest_run_vectors(ADBG_Case_t *c, const TEEC_UUID *uuid,
+		       const struct xtest_vector_ops *ops);
+
+#endif /*XTEST_VECTORS_H*/
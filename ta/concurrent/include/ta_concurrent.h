@@ -55,12 +55,20 @@ struct ta_concurrent_shm {
  * ta_concurent_shm which can be used to tell how many instances of this
  * function is running in parallel.
  *
+ * By default the digest operation and output buffer are allocated by the
+ * first invocation in the session and reused by the following ones. If
+ * TA_CONCURRENT_SHA256_FRESH_OP is set in params[1].value.a they are
+ * allocated and freed by this invocation instead.
+ *
  * in/out	params[0].memref
  * in/out	params[1].value.a	(input) number times to calcule the hash
+ *					| TA_CONCURRENT_SHA256_FRESH_OP
  * in/out	params[1].value.b	(output) max concurency
  * in		params[2].memref
  * out		params[3].memref
  */
 #define TA_CONCURRENT_CMD_SHA256	1
 
+#define TA_CONCURRENT_SHA256_FRESH_OP	(1u << 31)
+
 #endif /*TA_OS_TEST_H */
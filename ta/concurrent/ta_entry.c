@@ -41,19 +41,38 @@ void TA_DestroyEntryPoint(void)
 {
 }
 
+/*
+ * Digest operation and output buffer kept for the lifetime of the session
+ * so that TA_CONCURRENT_CMD_SHA256 doesn't have to allocate them on each
+ * invocation. They're allocated by the first digest command, sessions
+ * only doing busy loops never get them.
+ */
+struct concurrent_session {
+	TEE_OperationHandle op;
+	void *out;
+};
+
 TEE_Result TA_OpenSessionEntryPoint(uint32_t param_types,
 				    TEE_Param params[4],
 				    void **session_ctx)
 {
 	(void)param_types;
 	(void)params;
-	(void)session_ctx;
+
+	*session_ctx = TEE_Malloc(sizeof(struct concurrent_session), 0);
+	if (!*session_ctx)
+		return TEE_ERROR_OUT_OF_MEMORY;
 	return TEE_SUCCESS;
 }
 
 void TA_CloseSessionEntryPoint(void *session_ctx)
 {
-	(void)session_ctx;
+	struct concurrent_session *sess = session_ctx;
+
+	if (sess->op)
+		TEE_FreeOperation(sess->op);
+	TEE_Free(sess->out);
+	TEE_Free(sess);
 }
 
 static uint32_t inc_active_count(struct ta_concurrent_shm *shm)
@@ -100,13 +119,15 @@ static TEE_Result ta_entry_busy_loop(uint32_t param_types, TEE_Param params[4])
 	return TEE_SUCCESS;
 }
 
-static TEE_Result ta_entry_sha256(uint32_t param_types, TEE_Param params[4])
+static TEE_Result ta_entry_sha256(struct concurrent_session *sess,
+				  uint32_t param_types, TEE_Param params[4])
 {
-	TEE_Result res;
+	TEE_Result res = TEE_SUCCESS;
 	TEE_OperationHandle op = TEE_HANDLE_NULL;
-	void *out;
+	void *out = NULL;
 	uint32_t out_len;
 	size_t num_rounds;
+	bool fresh;
 	uint32_t req_param_types =
 		TEE_PARAM_TYPES(TEE_PARAM_TYPE_MEMREF_INOUT,
 				TEE_PARAM_TYPE_VALUE_INOUT,
@@ -126,19 +147,42 @@ static TEE_Result ta_entry_sha256(uint32_t param_types, TEE_Param params[4])
 
 	params[1].value.b = inc_active_count(params[0].memref.buffer);
 
-	out_len = params[3].memref.size;
-	out = TEE_Malloc(out_len, 0);
-	if (!out) {
-		res = TEE_ERROR_OUT_OF_MEMORY;
-		goto out;
+	fresh = params[1].value.a & TA_CONCURRENT_SHA256_FRESH_OP;
+	num_rounds = params[1].value.a & ~TA_CONCURRENT_SHA256_FRESH_OP;
+
+	if (fresh) {
+		out_len = params[3].memref.size;
+		out = TEE_Malloc(out_len, 0);
+		if (!out) {
+			res = TEE_ERROR_OUT_OF_MEMORY;
+			goto out;
+		}
+
+		res = TEE_AllocateOperation(&op, TEE_ALG_SHA256,
+					    TEE_MODE_DIGEST, 0);
+		if (res != TEE_SUCCESS)
+			goto out;
+	} else {
+		if (!sess->out) {
+			sess->out = TEE_Malloc(TEE_SHA256_HASH_SIZE, 0);
+			if (!sess->out) {
+				res = TEE_ERROR_OUT_OF_MEMORY;
+				goto out;
+			}
+		}
+		if (!sess->op) {
+			res = TEE_AllocateOperation(&sess->op, TEE_ALG_SHA256,
+						    TEE_MODE_DIGEST, 0);
+			if (res != TEE_SUCCESS) {
+				sess->op = TEE_HANDLE_NULL;
+				goto out;
+			}
+		}
+		op = sess->op;
+		out = sess->out;
+		out_len = TEE_SHA256_HASH_SIZE;
 	}
 
-	res = TEE_AllocateOperation(&op, TEE_ALG_SHA256, TEE_MODE_DIGEST, 0);
-	if (res != TEE_SUCCESS)
-		goto out;
-
-
-	num_rounds = params[1].value.a;
 	while (num_rounds) {
 		TEE_ResetOperation(op);
 		res = TEE_DigestDoFinal(op, params[2].memref.buffer,
@@ -150,10 +194,12 @@ static TEE_Result ta_entry_sha256(uint32_t param_types, TEE_Param params[4])
 	params[3].memref.size = out_len;
 
 out:
-	if (out)
-		TEE_Free(out);
-	if (op)
-		TEE_FreeOperation(op);
+	if (fresh) {
+		if (out)
+			TEE_Free(out);
+		if (op)
+			TEE_FreeOperation(op);
+	}
 	dec_active_count(params[0].memref.buffer);
 	return res;
 }
@@ -162,13 +208,11 @@ TEE_Result TA_InvokeCommandEntryPoint(void *session_ctx,
 				      uint32_t cmd_id, uint32_t param_types,
 				      TEE_Param params[4])
 {
-	(void)session_ctx;
-
 	switch (cmd_id) {
 	case TA_CONCURRENT_CMD_BUSY_LOOP:
 		return ta_entry_busy_loop(param_types, params);
 	case TA_CONCURRENT_CMD_SHA256:
-		return ta_entry_sha256(param_types, params);
+		return ta_entry_sha256(session_ctx, param_types, params);
 	default:
 		return TEE_ERROR_BAD_PARAMETERS;
 	}
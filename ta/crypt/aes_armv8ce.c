@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2015, Linaro Limited
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * AES using the ARMv8 Crypto Extensions (AESE/AESMC/AESD/AESIMC).
+ *
+ * The round keys are the ones produced by rijndaelSetupEncrypt() and
+ * rijndaelSetupDecrypt(), the decryption schedule is already in the form
+ * needed by the equivalent inverse cipher so AESD/AESIMC can use it
+ * directly. The keys are stored as host order 32-bit words and are
+ * converted to byte vectors once per call.
+ *
+ * There is no runtime check for the instructions. A TA runs at EL0
+ * where ID_AA64ISAR0_EL1 can't be read, and OP-TEE doesn't export the
+ * CPU features to TAs, so CFG_TA_CRYPT_ARMV8_CE=y must only be used for
+ * CPUs implementing them. On other CPUs the TA dies on an undefined
+ * instruction.
+ */
+
+#ifndef __aarch64__
+#error "aes_armv8ce.c requires an AArch64 TA"
+#endif
+
+#include <arm_neon.h>
+#include "aes_impl.h"
+
+#define AES_CE_MAX_ROUNDS	14
+#define AES_CE_INTERLEAVE	4
+
+static void load_round_keys(const unsigned long *rk, int nrounds,
+			    uint8x16_t *k)
+{
+	uint8_t b[16];
+	int r;
+	int n;
+
+	for (r = 0; r <= nrounds; r++) {
+		for (n = 0; n < 4; n++) {
+			b[4 * n] = rk[4 * r + n] >> 24;
+			b[4 * n + 1] = rk[4 * r + n] >> 16;
+			b[4 * n + 2] = rk[4 * r + n] >> 8;
+			b[4 * n + 3] = rk[4 * r + n];
+		}
+		k[r] = vld1q_u8(b);
+	}
+}
+
+void aes_armv8ce_encrypt_blocks(const unsigned long *rk, int nrounds,
+				const unsigned char *plaintext,
+				unsigned char *ciphertext, size_t nblocks)
+{
+	uint8x16_t k[AES_CE_MAX_ROUNDS + 1];
+	uint8x16_t s0, s1, s2, s3;
+	int r;
+
+	load_round_keys(rk, nrounds, k);
+
+	while (nblocks >= AES_CE_INTERLEAVE) {
+		s0 = vld1q_u8(plaintext);
+		s1 = vld1q_u8(plaintext + 16);
+		s2 = vld1q_u8(plaintext + 32);
+		s3 = vld1q_u8(plaintext + 48);
+		for (r = 0; r < nrounds - 1; r++) {
+			s0 = vaesmcq_u8(vaeseq_u8(s0, k[r]));
+			s1 = vaesmcq_u8(vaeseq_u8(s1, k[r]));
+			s2 = vaesmcq_u8(vaeseq_u8(s2, k[r]));
+			s3 = vaesmcq_u8(vaeseq_u8(s3, k[r]));
+		}
+		s0 = veorq_u8(vaeseq_u8(s0, k[r]), k[r + 1]);
+		s1 = veorq_u8(vaeseq_u8(s1, k[r]), k[r + 1]);
+		s2 = veorq_u8(vaeseq_u8(s2, k[r]), k[r + 1]);
+		s3 = veorq_u8(vaeseq_u8(s3, k[r]), k[r + 1]);
+		vst1q_u8(ciphertext, s0);
+		vst1q_u8(ciphertext + 16, s1);
+		vst1q_u8(ciphertext + 32, s2);
+		vst1q_u8(ciphertext + 48, s3);
+		plaintext += AES_CE_INTERLEAVE * 16;
+		ciphertext += AES_CE_INTERLEAVE * 16;
+		nblocks -= AES_CE_INTERLEAVE;
+	}
+
+	while (nblocks--) {
+		s0 = vld1q_u8(plaintext);
+		for (r = 0; r < nrounds - 1; r++)
+			s0 = vaesmcq_u8(vaeseq_u8(s0, k[r]));
+		s0 = veorq_u8(vaeseq_u8(s0, k[r]), k[r + 1]);
+		vst1q_u8(ciphertext, s0);
+		plaintext += 16;
+		ciphertext += 16;
+	}
+}
+
+void aes_armv8ce_decrypt_blocks(const unsigned long *rk, int nrounds,
+				const unsigned char *ciphertext,
+				unsigned char *plaintext, size_t nblocks)
+{
+	uint8x16_t k[AES_CE_MAX_ROUNDS + 1];
+	uint8x16_t s0, s1, s2, s3;
+	int r;
+
+	load_round_keys(rk, nrounds, k);
+
+	while (nblocks >= AES_CE_INTERLEAVE) {
+		s0 = vld1q_u8(ciphertext);
+		s1 = vld1q_u8(ciphertext + 16);
+		s2 = vld1q_u8(ciphertext + 32);
+		s3 = vld1q_u8(ciphertext + 48);
+		for (r = 0; r < nrounds - 1; r++) {
+			s0 = vaesimcq_u8(vaesdq_u8(s0, k[r]));
+			s1 = vaesimcq_u8(vaesdq_u8(s1, k[r]));
+			s2 = vaesimcq_u8(vaesdq_u8(s2, k[r]));
+			s3 = vaesimcq_u8(vaesdq_u8(s3, k[r]));
+		}
+		s0 = veorq_u8(vaesdq_u8(s0, k[r]), k[r + 1]);
+		s1 = veorq_u8(vaesdq_u8(s1, k[r]), k[r + 1]);
+		s2 = veorq_u8(vaesdq_u8(s2, k[r]), k[r + 1]);
+		s3 = veorq_u8(vaesdq_u8(s3, k[r]), k[r + 1]);
+		vst1q_u8(plaintext, s0);
+		vst1q_u8(plaintext + 16, s1);
+		vst1q_u8(plaintext + 32, s2);
+		vst1q_u8(plaintext + 48, s3);
+		ciphertext += AES_CE_INTERLEAVE * 16;
+		plaintext += AES_CE_INTERLEAVE * 16;
+		nblocks -= AES_CE_INTERLEAVE;
+	}
+
+	while (nblocks--) {
+		s0 = vld1q_u8(ciphertext);
+		for (r = 0; r < nrounds - 1; r++)
+			s0 = vaesimcq_u8(vaesdq_u8(s0, k[r]));
+		s0 = veorq_u8(vaesdq_u8(s0, k[r]), k[r + 1]);
+		vst1q_u8(plaintext, s0);
+		ciphertext += 16;
+		plaintext += 16;
+	}
+}
@@ -1252,3 +1252,172 @@ void rijndaelDecrypt(const u32 *rk, int nrounds, const u8 ciphertext[16],
 	    (Td4[(t0) & 0xff] & 0x000000ff) ^ rk[3];
 	PUTU32(plaintext + 12, s3);
 }
+
+/*
+ * Multi-block ECB helpers.
+ *
+ * AES_INTERLEAVE independent blocks are pushed through each round
+ * together so that the table lookups of one block can be issued while
+ * the lookups of another block are still in flight. Four blocks keep the
+ * whole state (32 words incl. temporaries) in registers on both ARMv7
+ * and ARMv8, eight blocks would spill on ARMv7.
+ */
+#define AES_INTERLEAVE	4
+
+#define ENC_ROUND(t, s, k) { \
+	(t)[0] = Te0[(s)[0] >> 24] ^ Te1[((s)[1] >> 16) & 0xff] ^ \
+		 Te2[((s)[2] >> 8) & 0xff] ^ Te3[(s)[3] & 0xff] ^ (k)[0]; \
+	(t)[1] = Te0[(s)[1] >> 24] ^ Te1[((s)[2] >> 16) & 0xff] ^ \
+		 Te2[((s)[3] >> 8) & 0xff] ^ Te3[(s)[0] & 0xff] ^ (k)[1]; \
+	(t)[2] = Te0[(s)[2] >> 24] ^ Te1[((s)[3] >> 16) & 0xff] ^ \
+		 Te2[((s)[0] >> 8) & 0xff] ^ Te3[(s)[1] & 0xff] ^ (k)[2]; \
+	(t)[3] = Te0[(s)[3] >> 24] ^ Te1[((s)[0] >> 16) & 0xff] ^ \
+		 Te2[((s)[1] >> 8) & 0xff] ^ Te3[(s)[2] & 0xff] ^ (k)[3]; }
+
+#define ENC_LAST_COL(t, a, b, c, d, k) \
+	((Te4[(t)[a] >> 24] & 0xff000000) ^ \
+	 (Te4[((t)[b] >> 16) & 0xff] & 0x00ff0000) ^ \
+	 (Te4[((t)[c] >> 8) & 0xff] & 0x0000ff00) ^ \
+	 (Te4[(t)[d] & 0xff] & 0x000000ff) ^ (k))
+
+#define DEC_ROUND(t, s, k) { \
+	(t)[0] = Td0[(s)[0] >> 24] ^ Td1[((s)[3] >> 16) & 0xff] ^ \
+		 Td2[((s)[2] >> 8) & 0xff] ^ Td3[(s)[1] & 0xff] ^ (k)[0]; \
+	(t)[1] = Td0[(s)[1] >> 24] ^ Td1[((s)[0] >> 16) & 0xff] ^ \
+		 Td2[((s)[3] >> 8) & 0xff] ^ Td3[(s)[2] & 0xff] ^ (k)[1]; \
+	(t)[2] = Td0[(s)[2] >> 24] ^ Td1[((s)[1] >> 16) & 0xff] ^ \
+		 Td2[((s)[0] >> 8) & 0xff] ^ Td3[(s)[3] & 0xff] ^ (k)[2]; \
+	(t)[3] = Td0[(s)[3] >> 24] ^ Td1[((s)[2] >> 16) & 0xff] ^ \
+		 Td2[((s)[1] >> 8) & 0xff] ^ Td3[(s)[0] & 0xff] ^ (k)[3]; }
+
+#define DEC_LAST_COL(t, a, b, c, d, k) \
+	((Td4[(t)[a] >> 24] & 0xff000000) ^ \
+	 (Td4[((t)[b] >> 16) & 0xff] & 0x00ff0000) ^ \
+	 (Td4[((t)[c] >> 8) & 0xff] & 0x0000ff00) ^ \
+	 (Td4[(t)[d] & 0xff] & 0x000000ff) ^ (k))
+
+#define LOAD_STATE(s, in, k) { \
+	(s)[0] = GETU32(in) ^ (k)[0]; \
+	(s)[1] = GETU32((in) + 4) ^ (k)[1]; \
+	(s)[2] = GETU32((in) + 8) ^ (k)[2]; \
+	(s)[3] = GETU32((in) + 12) ^ (k)[3]; }
+
+#define STORE_STATE(out, s) { \
+	PUTU32(out, (s)[0]); \
+	PUTU32((out) + 4, (s)[1]); \
+	PUTU32((out) + 8, (s)[2]); \
+	PUTU32((out) + 12, (s)[3]); }
+
+static void rijndaelEncrypt4(const u32 *rk, int nrounds, const u8 *plaintext,
+			     u8 *ciphertext)
+{
+	u32 s[AES_INTERLEAVE][4];
+	u32 t[AES_INTERLEAVE][4];
+	int r;
+
+	LOAD_STATE(s[0], plaintext, rk);
+	LOAD_STATE(s[1], plaintext + 16, rk);
+	LOAD_STATE(s[2], plaintext + 32, rk);
+	LOAD_STATE(s[3], plaintext + 48, rk);
+
+	r = nrounds >> 1;
+	for (;;) {
+		ENC_ROUND(t[0], s[0], rk + 4);
+		ENC_ROUND(t[1], s[1], rk + 4);
+		ENC_ROUND(t[2], s[2], rk + 4);
+		ENC_ROUND(t[3], s[3], rk + 4);
+		rk += 8;
+		if (--r == 0)
+			break;
+		ENC_ROUND(s[0], t[0], rk);
+		ENC_ROUND(s[1], t[1], rk);
+		ENC_ROUND(s[2], t[2], rk);
+		ENC_ROUND(s[3], t[3], rk);
+	}
+
+	for (r = 0; r < AES_INTERLEAVE; r++) {
+		s[r][0] = ENC_LAST_COL(t[r], 0, 1, 2, 3, rk[0]);
+		s[r][1] = ENC_LAST_COL(t[r], 1, 2, 3, 0, rk[1]);
+		s[r][2] = ENC_LAST_COL(t[r], 2, 3, 0, 1, rk[2]);
+		s[r][3] = ENC_LAST_COL(t[r], 3, 0, 1, 2, rk[3]);
+		STORE_STATE(ciphertext + r * 16, s[r]);
+	}
+}
+
+static void rijndaelDecrypt4(const u32 *rk, int nrounds, const u8 *ciphertext,
+			     u8 *plaintext)
+{
+	u32 s[AES_INTERLEAVE][4];
+	u32 t[AES_INTERLEAVE][4];
+	int r;
+
+	LOAD_STATE(s[0], ciphertext, rk);
+	LOAD_STATE(s[1], ciphertext + 16, rk);
+	LOAD_STATE(s[2], ciphertext + 32, rk);
+	LOAD_STATE(s[3], ciphertext + 48, rk);
+
+	r = nrounds >> 1;
+	for (;;) {
+		DEC_ROUND(t[0], s[0], rk + 4);
+		DEC_ROUND(t[1], s[1], rk + 4);
+		DEC_ROUND(t[2], s[2], rk + 4);
+		DEC_ROUND(t[3], s[3], rk + 4);
+		rk += 8;
+		if (--r == 0)
+			break;
+		DEC_ROUND(s[0], t[0], rk);
+		DEC_ROUND(s[1], t[1], rk);
+		DEC_ROUND(s[2], t[2], rk);
+		DEC_ROUND(s[3], t[3], rk);
+	}
+
+	for (r = 0; r < AES_INTERLEAVE; r++) {
+		s[r][0] = DEC_LAST_COL(t[r], 0, 3, 2, 1, rk[0]);
+		s[r][1] = DEC_LAST_COL(t[r], 1, 0, 3, 2, rk[1]);
+		s[r][2] = DEC_LAST_COL(t[r], 2, 1, 0, 3, rk[2]);
+		s[r][3] = DEC_LAST_COL(t[r], 3, 2, 1, 0, rk[3]);
+		STORE_STATE(plaintext + r * 16, s[r]);
+	}
+}
+
+/**
+ * Encrypt nblocks independent 16 byte blocks (ECB) with the expanded key.
+ * Blocks are processed AES_INTERLEAVE at a time, the remainder goes
+ * through rijndaelEncrypt().
+ */
+void rijndaelEncryptBlocks(const u32 *rk, int nrounds, const u8 *plaintext,
+			   u8 *ciphertext, size_t nblocks)
+{
+	while (nblocks >= AES_INTERLEAVE) {
+		rijndaelEncrypt4(rk, nrounds, plaintext, ciphertext);
+		plaintext += AES_INTERLEAVE * 16;
+		ciphertext += AES_INTERLEAVE * 16;
+		nblocks -= AES_INTERLEAVE;
+	}
+	while (nblocks--) {
+		rijndaelEncrypt(rk, nrounds, plaintext, ciphertext);
+		plaintext += 16;
+		ciphertext += 16;
+	}
+}
+
+/**
+ * Decrypt nblocks independent 16 byte blocks (ECB) with the expanded key.
+ * Blocks are processed AES_INTERLEAVE at a time, the remainder goes
+ * through rijndaelDecrypt().
+ */
+void rijndaelDecryptBlocks(const u32 *rk, int nrounds, const u8 *ciphertext,
+			   u8 *plaintext, size_t nblocks)
+{
+	while (nblocks >= AES_INTERLEAVE) {
+		rijndaelDecrypt4(rk, nrounds, ciphertext, plaintext);
+		ciphertext += AES_INTERLEAVE * 16;
+		plaintext += AES_INTERLEAVE * 16;
+		nblocks -= AES_INTERLEAVE;
+	}
+	while (nblocks--) {
+		rijndaelDecrypt(rk, nrounds, ciphertext, plaintext);
+		ciphertext += 16;
+		plaintext += 16;
+	}
+}
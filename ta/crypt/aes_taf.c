@@ -27,6 +27,7 @@
 
 #include "aes_taf.h"
 #include "aes_impl.h"
+#include "ta_crypt.h"
 
 /* Encryption/decryption key */
 const unsigned char key[KEYLENGTH(AES_256)] = {
@@ -39,22 +40,112 @@ const unsigned char key[KEYLENGTH(AES_256)] = {
 /* Encryption/decryption buffer */
 unsigned long rk[RKLENGTH(AES_256)];
 
-TEE_Result ta_entry_aes256ecb_encrypt(uint32_t param_types, TEE_Param params[4])
+struct aes_impl_ops {
+	void (*encrypt)(const unsigned long *sched, int nrounds,
+			const unsigned char *in, unsigned char *out,
+			size_t nblocks);
+	void (*decrypt)(const unsigned long *sched, int nrounds,
+			const unsigned char *in, unsigned char *out,
+			size_t nblocks);
+};
+
+static void encrypt_single_block(const unsigned long *sched, int nrounds,
+				 const unsigned char *in, unsigned char *out,
+				 size_t nblocks)
 {
-	size_t n_input_blocks;
 	size_t i;
 
+	for (i = 0; i < nblocks; i++)
+		rijndaelEncrypt(sched, nrounds, &in[i * (AES_BLOCK_SIZE / 8)],
+				&out[i * (AES_BLOCK_SIZE / 8)]);
+}
+
+static void decrypt_single_block(const unsigned long *sched, int nrounds,
+				 const unsigned char *in, unsigned char *out,
+				 size_t nblocks)
+{
+	size_t i;
+
+	for (i = 0; i < nblocks; i++)
+		rijndaelDecrypt(sched, nrounds, &in[i * (AES_BLOCK_SIZE / 8)],
+				&out[i * (AES_BLOCK_SIZE / 8)]);
+}
+
+static const struct aes_impl_ops aes_impls[] = {
+	[TA_CRYPT_AES_IMPL_SINGLE_BLOCK] = {
+		encrypt_single_block, decrypt_single_block
+	},
+	[TA_CRYPT_AES_IMPL_MULTI_BLOCK] = {
+		rijndaelEncryptBlocks, rijndaelDecryptBlocks
+	},
+#ifdef CFG_TA_CRYPT_ARMV8_CE
+	[TA_CRYPT_AES_IMPL_ARMV8_CE] = {
+		aes_armv8ce_encrypt_blocks, aes_armv8ce_decrypt_blocks
+	},
+#endif
+};
+
+/* The fastest implementation the TA is built with */
+static const struct aes_impl_ops *default_aes_impl(void)
+{
+#ifdef CFG_TA_CRYPT_ARMV8_CE
+	return &aes_impls[TA_CRYPT_AES_IMPL_ARMV8_CE];
+#else
+	return &aes_impls[TA_CRYPT_AES_IMPL_MULTI_BLOCK];
+#endif
+}
+
 /*
- * It is expected that memRef[0] is input buffer and memRef[1] is
- * output buffer.
+ * params[2] is optional, if present params[2].value.a selects the
+ * implementation, see TA_CRYPT_AES_IMPL_*
  */
-	if (param_types !=
+static TEE_Result get_aes_impl(uint32_t param_types, TEE_Param params[4],
+			       const struct aes_impl_ops **ops)
+{
+	uint32_t impl;
+
+	if (param_types ==
 	    TEE_PARAM_TYPES(TEE_PARAM_TYPE_MEMREF_INPUT,
 			    TEE_PARAM_TYPE_MEMREF_OUTPUT, TEE_PARAM_TYPE_NONE,
 			    TEE_PARAM_TYPE_NONE)) {
+		*ops = default_aes_impl();
+		return TEE_SUCCESS;
+	}
+
+	if (param_types !=
+	    TEE_PARAM_TYPES(TEE_PARAM_TYPE_MEMREF_INPUT,
+			    TEE_PARAM_TYPE_MEMREF_OUTPUT,
+			    TEE_PARAM_TYPE_VALUE_INPUT, TEE_PARAM_TYPE_NONE))
 		return TEE_ERROR_BAD_PARAMETERS;
+
+	impl = params[2].value.a;
+	if (impl == TA_CRYPT_AES_IMPL_DEFAULT) {
+		*ops = default_aes_impl();
+		return TEE_SUCCESS;
 	}
 
+	if (impl >= sizeof(aes_impls) / sizeof(aes_impls[0]) ||
+	    !aes_impls[impl].encrypt)
+		return TEE_ERROR_NOT_SUPPORTED;
+
+	*ops = &aes_impls[impl];
+	return TEE_SUCCESS;
+}
+
+TEE_Result ta_entry_aes256ecb_encrypt(uint32_t param_types, TEE_Param params[4])
+{
+	TEE_Result res;
+	const struct aes_impl_ops *ops;
+	size_t n_input_blocks;
+
+/*
+ * It is expected that memRef[0] is input buffer and memRef[1] is
+ * output buffer.
+ */
+	res = get_aes_impl(param_types, params, &ops);
+	if (res != TEE_SUCCESS)
+		return res;
+
 /* Check that input buffer is whole mult. of block size, in bits */
 	if ((params[0].memref.size << 8) % AES_BLOCK_SIZE != 0)
 		return TEE_ERROR_BAD_PARAMETERS;
@@ -68,33 +159,25 @@ TEE_Result ta_entry_aes256ecb_encrypt(uint32_t param_types, TEE_Param params[4])
 
 	n_input_blocks = params[0].memref.size / (AES_BLOCK_SIZE / 8);
 
-	for (i = 0; i < n_input_blocks; i++) {
-		const unsigned char *ciphertext = params[0].memref.buffer;
-		unsigned char *plaintext = params[1].memref.buffer;
-
-		rijndaelEncrypt(rk, NROUNDS(AES_256),
-				&ciphertext[i * (AES_BLOCK_SIZE / 8)],
-				&plaintext[i * (AES_BLOCK_SIZE / 8)]);
-	}
+	ops->encrypt(rk, NROUNDS(AES_256), params[0].memref.buffer,
+		     params[1].memref.buffer, n_input_blocks);
 
 	return TEE_SUCCESS;
 }
 
 TEE_Result ta_entry_aes256ecb_decrypt(uint32_t param_types, TEE_Param params[4])
 {
+	TEE_Result res;
+	const struct aes_impl_ops *ops;
 	size_t n_input_blocks;
-	size_t i;
 
 /*
  * It is expected that memRef[0] is input buffer and memRef[1] is
  * output buffer.
  */
-	if (param_types !=
-	    TEE_PARAM_TYPES(TEE_PARAM_TYPE_MEMREF_INPUT,
-			    TEE_PARAM_TYPE_MEMREF_OUTPUT, TEE_PARAM_TYPE_NONE,
-			    TEE_PARAM_TYPE_NONE)) {
-		return TEE_ERROR_BAD_PARAMETERS;
-	}
+	res = get_aes_impl(param_types, params, &ops);
+	if (res != TEE_SUCCESS)
+		return res;
 
 /* Check that input buffer is whole mult. of block size, in bits */
 	if ((params[0].memref.size << 8) % AES_BLOCK_SIZE != 0)
@@ -109,14 +192,8 @@ TEE_Result ta_entry_aes256ecb_decrypt(uint32_t param_types, TEE_Param params[4])
 
 	n_input_blocks = params[0].memref.size / (AES_BLOCK_SIZE / 8);
 
-	for (i = 0; i < n_input_blocks; i++) {
-		const unsigned char *ciphertext = params[0].memref.buffer;
-		unsigned char *plaintext = params[1].memref.buffer;
-
-		rijndaelDecrypt(rk, NROUNDS(AES_256),
-				&ciphertext[i * (AES_BLOCK_SIZE / 8)],
-				&plaintext[i * (AES_BLOCK_SIZE / 8)]);
-	}
+	ops->decrypt(rk, NROUNDS(AES_256), params[0].memref.buffer,
+		     params[1].memref.buffer, n_input_blocks);
 
 	return TEE_SUCCESS;
 }
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2015, Linaro Limited
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <tee_internal_api.h>
+#include <ta_crypt.h>
+#include "batch_taf.h"
+
+static TEE_Result resolve_ref(const struct ta_crypt_batch_cmd *cmds,
+			      size_t idx, uint32_t ref, uint32_t *val)
+{
+	size_t src = ref >> 3;
+	size_t param = (ref >> 1) & 0x3;
+	uint32_t pt;
+
+	/* Only outputs of sub-commands that already have run */
+	if (src >= idx)
+		return TEE_ERROR_BAD_PARAMETERS;
+
+	pt = TEE_PARAM_TYPE_GET(cmds[src].param_types, param);
+	if (pt != TEE_PARAM_TYPE_VALUE_OUTPUT &&
+	    pt != TEE_PARAM_TYPE_VALUE_INOUT)
+		return TEE_ERROR_BAD_PARAMETERS;
+
+	if (ref & 1)
+		*val = cmds[src].params[param].b;
+	else
+		*val = cmds[src].params[param].a;
+	return TEE_SUCCESS;
+}
+
+static TEE_Result prepare_params(const struct ta_crypt_batch_cmd *cmds,
+				 size_t idx,
+				 const struct ta_crypt_batch_cmd *cmd,
+				 uint8_t *data, size_t data_len,
+				 TEE_Param params[4])
+{
+	TEE_Result res;
+	size_t n;
+
+	for (n = 0; n < 4; n++) {
+		uint32_t a = cmd->params[n].a;
+		uint32_t b = cmd->params[n].b;
+		uint32_t refs = (cmd->refs >> (2 * n)) & 0x3;
+
+		switch (TEE_PARAM_TYPE_GET(cmd->param_types, n)) {
+		case TEE_PARAM_TYPE_NONE:
+		case TEE_PARAM_TYPE_VALUE_OUTPUT:
+			if (refs)
+				return TEE_ERROR_BAD_PARAMETERS;
+			params[n].value.a = 0;
+			params[n].value.b = 0;
+			break;
+		case TEE_PARAM_TYPE_VALUE_INPUT:
+		case TEE_PARAM_TYPE_VALUE_INOUT:
+			if (refs & 1) {
+				res = resolve_ref(cmds, idx, a, &a);
+				if (res != TEE_SUCCESS)
+					return res;
+			}
+			if (refs & 2) {
+				res = resolve_ref(cmds, idx, b, &b);
+				if (res != TEE_SUCCESS)
+					return res;
+			}
+			params[n].value.a = a;
+			params[n].value.b = b;
+			break;
+		case TEE_PARAM_TYPE_MEMREF_INPUT:
+		case TEE_PARAM_TYPE_MEMREF_OUTPUT:
+		case TEE_PARAM_TYPE_MEMREF_INOUT:
+			if (refs || a > data_len || b > data_len - a)
+				return TEE_ERROR_BAD_PARAMETERS;
+			params[n].memref.buffer = data + a;
+			params[n].memref.size = b;
+			break;
+		default:
+			return TEE_ERROR_BAD_PARAMETERS;
+		}
+	}
+
+	return TEE_SUCCESS;
+}
+
+static void update_params(struct ta_crypt_batch_cmd *cmd,
+			  const TEE_Param params[4])
+{
+	size_t n;
+
+	for (n = 0; n < 4; n++) {
+		switch (TEE_PARAM_TYPE_GET(cmd->param_types, n)) {
+		case TEE_PARAM_TYPE_VALUE_OUTPUT:
+		case TEE_PARAM_TYPE_VALUE_INOUT:
+			cmd->params[n].a = params[n].value.a;
+			cmd->params[n].b = params[n].value.b;
+			break;
+		case TEE_PARAM_TYPE_MEMREF_OUTPUT:
+		case TEE_PARAM_TYPE_MEMREF_INOUT:
+			cmd->params[n].b = params[n].memref.size;
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+TEE_Result ta_entry_batch(ta_crypt_invoke_fn invoke, void *sess,
+			  uint32_t param_types, TEE_Param params[4])
+{
+	struct ta_crypt_batch_hdr *hdr = params[0].memref.buffer;
+	struct ta_crypt_batch_cmd *cmds;
+	size_t blen = params[0].memref.size;
+	size_t tbl_len;
+	size_t num_cmds;
+	size_t n;
+
+	if (param_types !=
+	    TEE_PARAM_TYPES(TEE_PARAM_TYPE_MEMREF_INOUT, TEE_PARAM_TYPE_NONE,
+			    TEE_PARAM_TYPE_NONE, TEE_PARAM_TYPE_NONE)) {
+		return TEE_ERROR_BAD_PARAMETERS;
+	}
+
+	if (((uintptr_t)hdr & 0x3) || blen < sizeof(*hdr))
+		return TEE_ERROR_BAD_PARAMETERS;
+
+	num_cmds = hdr->num_cmds;
+	if (num_cmds > (blen - sizeof(*hdr)) / sizeof(*cmds))
+		return TEE_ERROR_BAD_PARAMETERS;
+	cmds = (struct ta_crypt_batch_cmd *)(void *)(hdr + 1);
+	tbl_len = sizeof(*hdr) + num_cmds * sizeof(*cmds);
+
+	hdr->num_done = 0;
+	for (n = 0; n < num_cmds; n++) {
+		/* Private copy, the table is in shared memory */
+		struct ta_crypt_batch_cmd cmd = cmds[n];
+		TEE_Param sub_params[4];
+		TEE_Result res;
+
+		res = prepare_params(cmds, n, &cmd, (uint8_t *)hdr + tbl_len,
+				     blen - tbl_len, sub_params);
+		if (res == TEE_SUCCESS) {
+			if (cmd.cmd_id == TA_CRYPT_CMD_BATCH)
+				res = TEE_ERROR_BAD_PARAMETERS;
+			else
+				res = invoke(sess, cmd.cmd_id, cmd.param_types,
+					     sub_params);
+			update_params(&cmd, sub_params);
+		}
+		cmd.ret = res;
+		cmds[n] = cmd;
+		if (res != TEE_SUCCESS)
+			return res;
+		hdr->num_done = n + 1;
+	}
+
+	return TEE_SUCCESS;
+}
@@ -26,6 +26,7 @@
  */
 
 #include <tee_internal_api.h>
+#include <ta_crypt.h>
 #include "cryp_taf.h"
 
 #define ASSERT_PARAM_TYPE(pt)                    \
@@ -190,6 +191,15 @@ TEE_Result ta_entry_cipher_update(uint32_t param_type, TEE_Param params[4])
 {
 	TEE_OperationHandle op = VAL2HANDLE(params[0].value.a);
 
+	if (param_type == TEE_PARAM_TYPES(TEE_PARAM_TYPE_VALUE_INPUT,
+					  TEE_PARAM_TYPE_MEMREF_INOUT,
+					  TEE_PARAM_TYPE_NONE,
+					  TEE_PARAM_TYPE_NONE))
+		return TEE_CipherUpdate(op,
+				params[1].memref.buffer, params[1].memref.size,
+				params[1].memref.buffer,
+				&params[1].memref.size);
+
 	ASSERT_PARAM_TYPE(TEE_PARAM_TYPES
 			  (TEE_PARAM_TYPE_VALUE_INPUT,
 			   TEE_PARAM_TYPE_MEMREF_INPUT,
@@ -330,64 +340,96 @@ struct attr_packed {
 	uint32_t b;
 };
 
-static TEE_Result unpack_attrs(const uint8_t *buf, size_t blen,
-			       TEE_Attribute **attrs, uint32_t *attr_count)
+/* Populate of up to this many attributes is done without TEE_Malloc() */
+#define MAX_STACK_ATTRS		8
+
+static TEE_Result get_attr_count(const uint8_t *buf, size_t blen,
+				 uint32_t *attr_count)
 {
-	TEE_Result res = TEE_SUCCESS;
-	TEE_Attribute *a = NULL;
-	const struct attr_packed *ap;
-	size_t num_attrs = 0;
 	const size_t num_attrs_size = sizeof(uint32_t);
+	uint32_t num_attrs;
 
-	if (blen == 0)
-		goto out;
+	if (blen == 0) {
+		*attr_count = 0;
+		return TEE_SUCCESS;
+	}
 
 	if (((uintptr_t)buf & 0x3) != 0 || blen < num_attrs_size)
 		return TEE_ERROR_BAD_PARAMETERS;
-	num_attrs = *(uint32_t *) (void *)buf;
-	if ((blen - num_attrs_size) < (num_attrs * sizeof(*ap)))
+	num_attrs = *(const uint32_t *)(const void *)buf;
+	if ((blen - num_attrs_size) / sizeof(struct attr_packed) < num_attrs)
 		return TEE_ERROR_BAD_PARAMETERS;
-	ap = (const struct attr_packed *)(const void *)(buf + num_attrs_size);
 
-	if (num_attrs > 0) {
-		size_t n;
+	*attr_count = num_attrs;
+	return TEE_SUCCESS;
+}
 
-		a = TEE_Malloc(num_attrs * sizeof(TEE_Attribute), 0);
-		if (!a)
-			return TEE_ERROR_OUT_OF_MEMORY;
-		for (n = 0; n < num_attrs; n++) {
-			uintptr_t p;
+/*
+ * Fills in a[] from the packed attributes in buf, the references point
+ * into buf so nothing is copied. buf may be shared with the client, each
+ * packed attribute is copied before it's looked at so it can't change
+ * between the checks and the use.
+ */
+static TEE_Result parse_attrs(const uint8_t *buf, size_t blen,
+			      TEE_Attribute *a, uint32_t num_attrs)
+{
+	const struct attr_packed *ap;
+	size_t n;
+
+	ap = (const struct attr_packed *)(const void *)(buf + sizeof(uint32_t));
 
-			a[n].attributeID = ap[n].id;
+	for (n = 0; n < num_attrs; n++) {
+		struct attr_packed pa;
+		uintptr_t p;
+
+		TEE_MemMove(&pa, ap + n, sizeof(pa));
+
+		a[n].attributeID = pa.id;
 #define TEE_ATTR_BIT_VALUE		  (1 << 29)
-			if (ap[n].id & TEE_ATTR_BIT_VALUE) {
-				a[n].content.value.a = ap[n].a;
-				a[n].content.value.b = ap[n].b;
-				continue;
-			}
-
-			a[n].content.ref.length = ap[n].b;
-			p = (uintptr_t)ap[n].a;
-			if (p) {
-				if ((p + a[n].content.ref.length) > blen) {
-					res = TEE_ERROR_BAD_PARAMETERS;
-					goto out;
-				}
-				p += (uintptr_t)buf;
-			}
-			a[n].content.ref.buffer = (void *)p;
+		if (pa.id & TEE_ATTR_BIT_VALUE) {
+			a[n].content.value.a = pa.a;
+			a[n].content.value.b = pa.b;
+			continue;
+		}
+
+		a[n].content.ref.length = pa.b;
+		p = (uintptr_t)pa.a;
+		if (p) {
+			if (p > blen || pa.b > blen - p)
+				return TEE_ERROR_BAD_PARAMETERS;
+			p += (uintptr_t)buf;
 		}
+		a[n].content.ref.buffer = (void *)p;
 	}
 
-	res = TEE_SUCCESS;
-out:
-	if (res == TEE_SUCCESS) {
-		*attrs = a;
-		*attr_count = num_attrs;
-	} else {
-		TEE_Free(a);
+	return TEE_SUCCESS;
+}
+
+static TEE_Result unpack_attrs(const uint8_t *buf, size_t blen,
+			       TEE_Attribute **attrs, uint32_t *attr_count)
+{
+	TEE_Result res;
+	TEE_Attribute *a = NULL;
+	uint32_t num_attrs;
+
+	res = get_attr_count(buf, blen, &num_attrs);
+	if (res != TEE_SUCCESS)
+		return res;
+
+	if (num_attrs > 0) {
+		a = TEE_Malloc(num_attrs * sizeof(TEE_Attribute), 0);
+		if (!a)
+			return TEE_ERROR_OUT_OF_MEMORY;
+		res = parse_attrs(buf, blen, a, num_attrs);
+		if (res != TEE_SUCCESS) {
+			TEE_Free(a);
+			return res;
+		}
 	}
-	return res;
+
+	*attrs = a;
+	*attr_count = num_attrs;
+	return TEE_SUCCESS;
 }
 
 TEE_Result ta_entry_populate_transient_object(uint32_t param_type,
@@ -403,6 +445,26 @@ TEE_Result ta_entry_populate_transient_object(uint32_t param_type,
 			   TEE_PARAM_TYPE_MEMREF_INPUT, TEE_PARAM_TYPE_NONE,
 			   TEE_PARAM_TYPE_NONE));
 
+	res = get_attr_count(params[1].memref.buffer, params[1].memref.size,
+			     &attr_count);
+	if (res != TEE_SUCCESS)
+		return res;
+
+	/*
+	 * The common case is parsed in place into a small array on the
+	 * stack, the attribute data stays in the memref.
+	 */
+	if (attr_count <= MAX_STACK_ATTRS) {
+		TEE_Attribute stack_attrs[MAX_STACK_ATTRS];
+
+		res = parse_attrs(params[1].memref.buffer,
+				  params[1].memref.size, stack_attrs,
+				  attr_count);
+		if (res != TEE_SUCCESS)
+			return res;
+		return TEE_PopulateTransientObject(o, stack_attrs, attr_count);
+	}
+
 	res = unpack_attrs(params[1].memref.buffer, params[1].memref.size,
 			   &attrs, &attr_count);
 	if (res != TEE_SUCCESS)
@@ -615,6 +677,16 @@ TEE_Result ta_entry_ae_update(uint32_t param_type, TEE_Param params[4])
 {
 	TEE_OperationHandle op = VAL2HANDLE(params[0].value.a);
 
+	if (param_type == TEE_PARAM_TYPES(TEE_PARAM_TYPE_VALUE_INPUT,
+					  TEE_PARAM_TYPE_MEMREF_INOUT,
+					  TEE_PARAM_TYPE_NONE,
+					  TEE_PARAM_TYPE_NONE)) {
+		TEE_AEUpdate(op, params[1].memref.buffer,
+			     params[1].memref.size, params[1].memref.buffer,
+			     &params[1].memref.size);
+		return TEE_SUCCESS;
+	}
+
 	ASSERT_PARAM_TYPE(TEE_PARAM_TYPES
 			  (TEE_PARAM_TYPE_VALUE_INPUT,
 			   TEE_PARAM_TYPE_MEMREF_INPUT,
@@ -686,3 +758,77 @@ TEE_Result ta_entry_get_object_value_attribute(uint32_t param_type,
 	return TEE_GetObjectValueAttribute(o, params[0].value.b,
 				   &params[1].value.a, &params[1].value.b);
 }
+
+TEE_Result ta_entry_digest_fork(uint32_t param_type, TEE_Param params[4])
+{
+	TEE_Result res;
+	TEE_OperationHandle prefix_op = TEE_HANDLE_NULL;
+	TEE_OperationHandle op = TEE_HANDLE_NULL;
+	TEE_OperationInfo info;
+	uint32_t alg = params[0].value.a;
+	uint32_t rehash = params[0].value.b & TA_CRYPT_DIGEST_FORK_REHASH;
+	uint32_t num_branches = params[0].value.b ^ rehash;
+	uint8_t *prefix = params[1].memref.buffer;
+	size_t prefix_size = params[1].memref.size;
+	uint8_t *suffix = params[2].memref.buffer;
+	size_t suffix_size;
+	uint8_t *digest = params[3].memref.buffer;
+	uint32_t digest_size;
+	uint32_t dlen;
+	size_t n;
+
+	ASSERT_PARAM_TYPE(TEE_PARAM_TYPES
+			  (TEE_PARAM_TYPE_VALUE_INPUT,
+			   TEE_PARAM_TYPE_MEMREF_INPUT,
+			   TEE_PARAM_TYPE_MEMREF_INPUT,
+			   TEE_PARAM_TYPE_MEMREF_OUTPUT));
+
+	if (!num_branches || params[2].memref.size % num_branches)
+		return TEE_ERROR_BAD_PARAMETERS;
+	suffix_size = params[2].memref.size / num_branches;
+
+	res = TEE_AllocateOperation(&op, alg, TEE_MODE_DIGEST, 0);
+	if (res != TEE_SUCCESS)
+		return res;
+
+	TEE_GetOperationInfo(op, &info);
+	digest_size = info.digestLength;
+	if (params[3].memref.size / digest_size < num_branches) {
+		/* Empty suffixes leave n unbounded by the input size */
+		if (num_branches <= UINT32_MAX / digest_size)
+			params[3].memref.size = num_branches * digest_size;
+		res = TEE_ERROR_SHORT_BUFFER;
+		goto out;
+	}
+
+	if (!rehash) {
+		res = TEE_AllocateOperation(&prefix_op, alg,
+					    TEE_MODE_DIGEST, 0);
+		if (res != TEE_SUCCESS)
+			goto out;
+		TEE_DigestUpdate(prefix_op, prefix, prefix_size);
+	}
+
+	for (n = 0; n < num_branches; n++) {
+		if (rehash) {
+			TEE_ResetOperation(op);
+			TEE_DigestUpdate(op, prefix, prefix_size);
+		} else {
+			TEE_CopyOperation(op, prefix_op);
+		}
+
+		dlen = digest_size;
+		res = TEE_DigestDoFinal(op, suffix + n * suffix_size,
+					suffix_size, digest + n * digest_size,
+					&dlen);
+		if (res != TEE_SUCCESS)
+			goto out;
+	}
+	params[3].memref.size = num_branches * digest_size;
+
+out:
+	if (prefix_op)
+		TEE_FreeOperation(prefix_op);
+	TEE_FreeOperation(op);
+	return res;
+}
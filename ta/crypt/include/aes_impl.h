@@ -28,6 +28,8 @@
 #ifndef AES_IMPL_H
 #define AES_IMPL_H
 
+#include <stddef.h>
+
 int rijndaelSetupEncrypt(unsigned long *rk, const unsigned char *key,
 			 int keybits);
 
@@ -42,6 +44,28 @@ void rijndaelDecrypt(const unsigned long *rk, int nrounds,
 		     const unsigned char ciphertext[16],
 		     unsigned char plaintext[16]);
 
+void rijndaelEncryptBlocks(const unsigned long *rk, int nrounds,
+			   const unsigned char *plaintext,
+			   unsigned char *ciphertext, size_t nblocks);
+
+void rijndaelDecryptBlocks(const unsigned long *rk, int nrounds,
+			   const unsigned char *ciphertext,
+			   unsigned char *plaintext, size_t nblocks);
+
+#ifdef CFG_TA_CRYPT_ARMV8_CE
+/*
+ * ARMv8 Crypto Extensions, same key schedules as above. Only built with
+ * CFG_TA_CRYPT_ARMV8_CE=y, which is the only check that the CPU has them.
+ */
+void aes_armv8ce_encrypt_blocks(const unsigned long *rk, int nrounds,
+				const unsigned char *plaintext,
+				unsigned char *ciphertext, size_t nblocks);
+
+void aes_armv8ce_decrypt_blocks(const unsigned long *rk, int nrounds,
+				const unsigned char *ciphertext,
+				unsigned char *plaintext, size_t nblocks);
+#endif
+
 #define AES_BLOCK_SIZE		128
 
 #define AES_128			128
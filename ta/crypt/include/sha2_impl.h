@@ -69,14 +69,14 @@
 #define SHA224_BLOCK_SIZE  SHA256_BLOCK_SIZE
 
 struct sha224_ctx {
-	unsigned int tot_len;
+	uint64_t tot_len;
 	unsigned int len;
 	unsigned char block[2 * SHA224_BLOCK_SIZE];
 	uint32_t h[8];
 };
 
 struct sha256_ctx {
-	unsigned int tot_len;
+	uint64_t tot_len;
 	unsigned int len;
 	unsigned char block[2 * SHA256_BLOCK_SIZE];
 	uint32_t h[8];
@@ -98,4 +98,31 @@ void sha256(const unsigned char *message, unsigned int len,
 
 void sha256_transf(struct sha256_ctx *ctx, const unsigned char *message,
 		   unsigned int block_nb);
+
+extern uint32_t sha256_h0[8];
+extern uint32_t sha256_k[64];
+
+typedef void (*sha256_transf_fn)(struct sha256_ctx *ctx,
+				 const unsigned char *message,
+				 unsigned int block_nb);
+
+void sha256_transf_rolled(struct sha256_ctx *ctx, const unsigned char *message,
+			  unsigned int block_nb);
+void sha256_transf_unrolled(struct sha256_ctx *ctx,
+			    const unsigned char *message,
+			    unsigned int block_nb);
+
+#ifdef CFG_TA_CRYPT_ARMV8_CE
+/* SHA256H/SHA256H2/SHA256SU0/SHA256SU1 from the ARMv8 Crypto Extensions */
+void sha256_armv8ce_transf(struct sha256_ctx *ctx,
+			   const unsigned char *message,
+			   unsigned int block_nb);
+#endif
+
+/*
+ * Selects the block function used by sha224_*() and sha256_*(), NULL
+ * restores the default (the Crypto Extensions when built with
+ * CFG_TA_CRYPT_ARMV8_CE, else the UNROLL_LOOPS choice)
+ */
+void sha256_set_transf(sha256_transf_fn fn);
 #endif
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2015, Linaro Limited
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SHA2_MB_H
+#define SHA2_MB_H
+
+#include <stdint.h>
+#include "sha2_impl.h"
+
+/* Number of messages hashed side by side */
+#define SHA256_MB_LANES	4
+
+struct sha256_mb_lane {
+	const unsigned char *next;	/* next full block of the message */
+	unsigned int full_blocks;	/* full blocks left in the message */
+	unsigned int pad_blocks;	/* 1 or 2 blocks with the padding */
+	unsigned int pad_pos;		/* next block in pad */
+	unsigned char pad[2 * SHA256_BLOCK_SIZE];
+	unsigned char *digest;
+};
+
+/* Too large for the TA stack, the caller allocates it */
+struct sha256_mb_ctx {
+	uint32_t h[8][SHA256_MB_LANES];
+	uint32_t w[64][SHA256_MB_LANES];
+	struct sha256_mb_lane lane[SHA256_MB_LANES];
+};
+
+/*
+ * Computes SHA-256 of n messages. offs_len holds n pairs of uint32_t,
+ * offset from base and length of each message. The digests are stored
+ * back to back in digests. Bounds must be checked by the caller.
+ */
+void sha256_mb(struct sha256_mb_ctx *ctx, const unsigned char *base,
+	       const uint32_t *offs_len, unsigned int n,
+	       unsigned char *digests);
+
+#endif
@@ -29,6 +29,16 @@
 #define SHA2_TAF_H
 
 #include <tee_api.h>
+#include "sha2_impl.h"
+
+/* Streaming SHA-224/256 state, kept in the session context */
+struct sha2_taf_stream {
+	uint32_t algo;		/* TEE_ALG_SHA224, TEE_ALG_SHA256 or 0 */
+	union {
+		struct sha224_ctx sha224;
+		struct sha256_ctx sha256;
+	} ctx;
+};
 
 /* params[0] is input buffer and params[1] is output buffer */
 TEE_Result ta_entry_sha224(uint32_t param_types, TEE_Param params[4]);
@@ -36,4 +46,18 @@ TEE_Result ta_entry_sha224(uint32_t param_types, TEE_Param params[4]);
 /* params[0] is input buffer and params[1] is output buffer */
 TEE_Result ta_entry_sha256(uint32_t param_types, TEE_Param params[4]);
 
+/* See TA_CRYPT_CMD_SHA256_BENCH */
+TEE_Result ta_entry_sha256_bench(uint32_t param_types, TEE_Param params[4]);
+
+/* See TA_CRYPT_CMD_SHA256_MULTI */
+TEE_Result ta_entry_sha256_multi(uint32_t param_types, TEE_Param params[4]);
+
+/* See TA_CRYPT_CMD_SHA2_INIT, _UPDATE and _FINAL */
+TEE_Result ta_entry_sha2_init(struct sha2_taf_stream *st,
+			      uint32_t param_types, TEE_Param params[4]);
+TEE_Result ta_entry_sha2_update(struct sha2_taf_stream *st,
+				uint32_t param_types, TEE_Param params[4]);
+TEE_Result ta_entry_sha2_final(struct sha2_taf_stream *st,
+			       uint32_t param_types, TEE_Param params[4]);
+
 #endif
@@ -28,16 +28,48 @@
 #ifndef TA_CRYPT_H
 #define TA_CRYPT_H
 
+#include <stdint.h>
+
 /* This UUID is generated with the ITU-T UUID generator at
    http://www.itu.int/ITU-T/asn1/uuid.html */
 #define TA_CRYPT_UUID { 0xcb3e5ba0, 0xadf1, 0x11e0, \
 	{ 0x99, 0x8b, 0x00, 0x02, 0xa5, 0xd5, 0xc5, 0x1b } }
 
 #define TA_CRYPT_CMD_SHA224             1
+
+/*
+ * SHA-256
+ * in       params[0].memref  = input
+ * out      params[1].memref  = digest
+ * in       params[2].value.a = block function, TA_CRYPT_SHA256_IMPL_*
+ *                              (optional, params[2] may be NONE)
+ *
+ * Without params[2] the default block function is used, the ARMv8
+ * Crypto Extensions when the TA is built with them. Asking for one that
+ * isn't available gives TEE_ERROR_NOT_SUPPORTED.
+ */
 #define TA_CRYPT_CMD_SHA256             2
+
+/*
+ * AES-256 ECB with the fixed key in aes_taf.c
+ * in       params[0].memref  = input
+ * out      params[1].memref  = output
+ * in       params[2].value.a = implementation, TA_CRYPT_AES_IMPL_*
+ *                              (optional, params[2] may be NONE)
+ *
+ * TA_CRYPT_AES_IMPL_DEFAULT picks the ARMv8 Crypto Extensions when the TA
+ * is built with them and the T-table multi-block code otherwise. Asking
+ * for an implementation that isn't available gives
+ * TEE_ERROR_NOT_SUPPORTED.
+ */
 #define TA_CRYPT_CMD_AES256ECB_ENC      3
 #define TA_CRYPT_CMD_AES256ECB_DEC      4
 
+#define TA_CRYPT_AES_IMPL_DEFAULT       0
+#define TA_CRYPT_AES_IMPL_SINGLE_BLOCK  1
+#define TA_CRYPT_AES_IMPL_MULTI_BLOCK   2
+#define TA_CRYPT_AES_IMPL_ARMV8_CE      3
+
 /*
  * TEE_Result TEE_AllocateOperation(TEE_OperationHandle *operation,
  *              uint32_t algorithm, uint32_t mode, uint32_t maxKeySize);
@@ -126,6 +158,13 @@
  * in       params[0].value.a = operation
  * in       params[1].memref = srcData
  * out      params[2].memref = dstData
+ *
+ * or in place, where the output replaces the input
+ * in       params[0].value.a = operation
+ * in/out   params[1].memref = srcData/destData
+ *
+ * In place requires that no partial block is kept from an earlier update,
+ * that is all updates but the last are a multiple of the block size.
  */
 #define TA_CRYPT_CMD_CIPHER_UPDATE      15
 
@@ -312,6 +351,10 @@
  * in       params[0].value.a = operation
  * in       params[1].memref = srcData
  * out      params[2].memref = destData
+ *
+ * or in place with the same restriction as TA_CRYPT_CMD_CIPHER_UPDATE
+ * in       params[0].value.a = operation
+ * in/out   params[1].memref = srcData/destData
  */
 #define TA_CRYPT_CMD_AE_UPDATE                  35
 
@@ -362,4 +405,115 @@
 #define TA_CRYPT_CMD_SETGLOBAL     40
 #define TA_CRYPT_CMD_GETGLOBAL     41
 
+/*
+ * Times SHA-256 of the same buffer with each available block function
+ * in       params[0].memref  = data
+ * in       params[1].value.a = number of iterations
+ * out      params[2].memref  = uint32_t[TA_CRYPT_SHA256_IMPL_COUNT],
+ *                              elapsed ms or TA_CRYPT_BENCH_NOT_AVAILABLE
+ * out      params[3].memref  = TA_CRYPT_SHA256_IMPL_COUNT digests
+ */
+#define TA_CRYPT_CMD_SHA256_BENCH  42
+
+#define TA_CRYPT_SHA256_IMPL_ROLLED     0
+#define TA_CRYPT_SHA256_IMPL_UNROLLED   1
+#define TA_CRYPT_SHA256_IMPL_ARMV8_CE   2
+#define TA_CRYPT_SHA256_IMPL_COUNT      3
+
+#define TA_CRYPT_BENCH_NOT_AVAILABLE    0xffffffff
+
+/* One entry of the TA_CRYPT_CMD_SHA256_MULTI message table */
+struct ta_crypt_sha256_msg {
+	uint32_t offs;
+	uint32_t len;
+};
+
+/*
+ * SHA-256 of many independent messages in one invocation
+ * in       params[0].memref  = struct ta_crypt_sha256_msg[n]
+ * in       params[1].memref  = data the messages are taken from
+ * out      params[2].memref  = n digests, back to back
+ */
+#define TA_CRYPT_CMD_SHA256_MULTI  43
+
+/*
+ * Streaming SHA-224/SHA-256, the state is kept in the session so the
+ * input can be passed in as many windows as needed. INIT restarts any
+ * ongoing digest, UPDATE and FINAL without INIT gives
+ * TEE_ERROR_BAD_STATE. FINAL ends the stream.
+ *
+ * TA_CRYPT_CMD_SHA2_INIT
+ * in       params[0].value.a = TEE_ALG_SHA224 or TEE_ALG_SHA256
+ *
+ * TA_CRYPT_CMD_SHA2_UPDATE
+ * in       params[0].memref  = data
+ *
+ * TA_CRYPT_CMD_SHA2_FINAL
+ * out      params[0].memref  = digest
+ */
+#define TA_CRYPT_CMD_SHA2_INIT     44
+#define TA_CRYPT_CMD_SHA2_UPDATE   45
+#define TA_CRYPT_CMD_SHA2_FINAL    46
+
+/*
+ * Runs a list of sub-commands in one invocation
+ * in/out   params[0].memref = struct ta_crypt_batch_hdr, followed by
+ *                             hdr.num_cmds struct ta_crypt_batch_cmd,
+ *                             followed by the data area
+ *
+ * Each sub-command is one of the other commands above with its
+ * parameters encoded as a/b pairs. Values are passed as is, memrefs as
+ * an offset into the data area (a) and a size (b). Output values and
+ * output memref sizes are written back in place.
+ *
+ * A value input with its bit (1 << (2 * param + field)) set in refs
+ * takes the value from an output of an earlier sub-command instead, the
+ * a/b word is then TA_CRYPT_BATCH_REF(). This is how handles are chained,
+ * for instance an allocated operation passed on to AE_INIT.
+ *
+ * The sub-commands are run in order until one fails, the result of each
+ * is stored in its ret field. hdr.num_done is updated with the number of
+ * successful sub-commands and the first failure is returned. A batch
+ * can't contain another TA_CRYPT_CMD_BATCH.
+ */
+#define TA_CRYPT_CMD_BATCH         47
+
+struct ta_crypt_batch_hdr {
+	uint32_t num_cmds;
+	uint32_t num_done;
+};
+
+struct ta_crypt_batch_param {
+	uint32_t a;
+	uint32_t b;
+};
+
+struct ta_crypt_batch_cmd {
+	uint32_t cmd_id;
+	uint32_t param_types;
+	uint32_t refs;
+	uint32_t ret;
+	struct ta_crypt_batch_param params[4];
+};
+
+#define TA_CRYPT_BATCH_REF(cmd, param, field) \
+	(((cmd) << 3) | ((param) << 1) | (field))
+#define TA_CRYPT_BATCH_REF_BIT(param, field) \
+	(1 << (2 * (param) + (field)))
+
+/*
+ * Digests a common prefix followed by each of n suffixes. The prefix is
+ * digested once and forked into each branch with TEE_CopyOperation(),
+ * or with TA_CRYPT_DIGEST_FORK_REHASH digested again for each branch.
+ * The suffixes are of equal size, back to back.
+ * in       params[0].value.a = digest algorithm
+ * in       params[0].value.b = n | TA_CRYPT_DIGEST_FORK_REHASH
+ * in       params[1].memref  = prefix
+ * in       params[2].memref  = n suffixes
+ * out      params[3].memref  = n digests, back to back
+ */
+#define TA_CRYPT_CMD_DIGEST_FORK   48
+
+#define TA_CRYPT_DIGEST_FORK_REHASH     (1u << 31)
+
 #endif /*TA_CRYPT_H */
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2015, Linaro Limited
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * SHA-256 block function using the ARMv8 Crypto Extensions. Like
+ * aes_armv8ce.c there's no runtime check for the instructions, the TA
+ * must only be built with CFG_TA_CRYPT_ARMV8_CE=y for CPUs having them.
+ */
+
+#ifndef __aarch64__
+#error "sha2_armv8ce.c requires an AArch64 TA"
+#endif
+
+#include <arm_neon.h>
+#include "sha2_impl.h"
+
+void sha256_armv8ce_transf(struct sha256_ctx *ctx,
+			   const unsigned char *message,
+			   unsigned int block_nb)
+{
+	uint32x4_t abcd = vld1q_u32(&ctx->h[0]);
+	uint32x4_t efgh = vld1q_u32(&ctx->h[4]);
+	uint32x4_t abcd_save;
+	uint32x4_t efgh_save;
+	uint32x4_t msg[4];
+	uint32x4_t wk;
+	uint32x4_t tmp;
+	unsigned int i;
+	int j;
+
+	for (i = 0; i < block_nb; i++) {
+		abcd_save = abcd;
+		efgh_save = efgh;
+
+		for (j = 0; j < 4; j++)
+			msg[j] = vreinterpretq_u32_u8(
+					vrev32q_u8(vld1q_u8(message + 16 * j)));
+
+		/* Four rounds per step, the schedule runs three steps ahead */
+		for (j = 0; j < 16; j++) {
+			wk = vaddq_u32(msg[j & 3], vld1q_u32(&sha256_k[4 * j]));
+			if (j < 12)
+				msg[j & 3] = vsha256su1q_u32(
+					vsha256su0q_u32(msg[j & 3],
+							msg[(j + 1) & 3]),
+					msg[(j + 2) & 3], msg[(j + 3) & 3]);
+			tmp = abcd;
+			abcd = vsha256hq_u32(abcd, efgh, wk);
+			efgh = vsha256h2q_u32(efgh, tmp, wk);
+		}
+
+		abcd = vaddq_u32(abcd, abcd_save);
+		efgh = vaddq_u32(efgh, efgh_save);
+		message += SHA256_BLOCK_SIZE;
+	}
+
+	vst1q_u32(&ctx->h[0], abcd);
+	vst1q_u32(&ctx->h[4], efgh);
+}
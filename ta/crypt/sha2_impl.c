@@ -132,24 +132,24 @@ uint32_t sha256_k[64] = {
 	0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
 };
 
-/* SHA-256 functions */
-void sha256_transf(struct sha256_ctx *ctx, const unsigned char *message,
-		   unsigned int block_nb)
+/*
+ * SHA-256 block functions, the rolled and the unrolled variant are both
+ * built so they can be compared. UNROLL_LOOPS still selects the one used
+ * by default when there's no hardware support.
+ */
+void sha256_transf_rolled(struct sha256_ctx *ctx, const unsigned char *message,
+			  unsigned int block_nb)
 {
 	uint32_t w[64];
 	uint32_t wv[8];
 	uint32_t t1, t2;
 	const unsigned char *sub_block;
 	int i;
-
-#ifndef UNROLL_LOOPS
 	int j;
-#endif
 
 	for (i = 0; i < (int)block_nb; i++) {
 		sub_block = message + (i << 6);
 
-#ifndef UNROLL_LOOPS
 		for (j = 0; j < 16; j++)
 			PACK32(&sub_block[j << 2], &w[j]);
 
@@ -175,7 +175,22 @@ void sha256_transf(struct sha256_ctx *ctx, const unsigned char *message,
 
 		for (j = 0; j < 8; j++)
 			ctx->h[j] += wv[j];
-#else
+	}
+}
+
+void sha256_transf_unrolled(struct sha256_ctx *ctx,
+			    const unsigned char *message,
+			    unsigned int block_nb)
+{
+	uint32_t w[64];
+	uint32_t wv[8];
+	uint32_t t1, t2;
+	const unsigned char *sub_block;
+	int i;
+
+	for (i = 0; i < (int)block_nb; i++) {
+		sub_block = message + (i << 6);
+
 		PACK32(&sub_block[0], &w[0]);
 		PACK32(&sub_block[4], &w[1]);
 		PACK32(&sub_block[8], &w[2]);
@@ -324,10 +339,37 @@ void sha256_transf(struct sha256_ctx *ctx, const unsigned char *message,
 		ctx->h[5] += wv[5];
 		ctx->h[6] += wv[6];
 		ctx->h[7] += wv[7];
-#endif
 	}
 }
 
+static sha256_transf_fn sha256_transf_impl;
+
+static sha256_transf_fn sha256_transf_default(void)
+{
+#ifdef CFG_TA_CRYPT_ARMV8_CE
+	return sha256_armv8ce_transf;
+#elif defined(UNROLL_LOOPS)
+	return sha256_transf_unrolled;
+#else
+	return sha256_transf_rolled;
+#endif
+}
+
+void sha256_set_transf(sha256_transf_fn fn)
+{
+	sha256_transf_impl = fn ? fn : sha256_transf_default();
+}
+
+/* SHA-256 functions */
+void sha256_transf(struct sha256_ctx *ctx, const unsigned char *message,
+		   unsigned int block_nb)
+{
+	if (!sha256_transf_impl)
+		sha256_transf_impl = sha256_transf_default();
+
+	sha256_transf_impl(ctx, message, block_nb);
+}
+
 void sha256(const unsigned char *message,
 	    unsigned int len, unsigned char *digest)
 {
@@ -393,14 +435,14 @@ void sha256_update(struct sha256_ctx *ctx, const unsigned char *message,
 		ctx->block[i] = shifted_message[(block_nb << 6) + i];
 
 	ctx->len = rem_len;
-	ctx->tot_len += (block_nb + 1) << 6;
+	ctx->tot_len += (uint64_t)(block_nb + 1) << 6;
 }
 
 void sha256_final(struct sha256_ctx *ctx, unsigned char *digest)
 {
 	unsigned int block_nb;
 	unsigned int pm_len;
-	unsigned int len_b;
+	uint64_t len_b;
 	unsigned long int i_m;
 
 #ifndef UNROLL_LOOPS
@@ -417,6 +459,7 @@ void sha256_final(struct sha256_ctx *ctx, unsigned char *digest)
 		ctx->block[ctx->len + i_m] = 0;
 
 	ctx->block[ctx->len] = 0x80;
+	UNPACK32(len_b >> 32, ctx->block + pm_len - 8);
 	UNPACK32(len_b, ctx->block + pm_len - 4);
 
 	sha256_transf(ctx, ctx->block, block_nb);
@@ -502,14 +545,14 @@ void sha224_update(struct sha224_ctx *ctx, const unsigned char *message,
 		ctx->block[i] = shifted_message[(block_nb << 6) + i];
 
 	ctx->len = rem_len;
-	ctx->tot_len += (block_nb + 1) << 6;
+	ctx->tot_len += (uint64_t)(block_nb + 1) << 6;
 }
 
 void sha224_final(struct sha224_ctx *ctx, unsigned char *digest)
 {
 	unsigned int block_nb;
 	unsigned int pm_len;
-	unsigned int len_b;
+	uint64_t len_b;
 	unsigned long int i_m;
 
 #ifndef UNROLL_LOOPS
@@ -526,6 +569,7 @@ void sha224_final(struct sha224_ctx *ctx, unsigned char *digest)
 		ctx->block[ctx->len + i_m] = 0;
 
 	ctx->block[ctx->len] = 0x80;
+	UNPACK32(len_b >> 32, ctx->block + pm_len - 8);
 	UNPACK32(len_b, ctx->block + pm_len - 4);
 
 	sha256_transf((struct sha256_ctx *)ctx, ctx->block, block_nb);
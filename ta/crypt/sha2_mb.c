@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2015, Linaro Limited
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Multi-buffer SHA-256: SHA256_MB_LANES independent messages are run
+ * through the compression function together, one block of each per
+ * step. All loops over the lanes are innermost so the compiler can keep
+ * the lanes in separate registers or map them onto NEON lanes. When a
+ * message is done the lane is refilled with the next one.
+ */
+
+#include <string.h>
+#include "sha2_mb.h"
+
+#define ROTR(x, n)	(((x) >> (n)) | ((x) << (32 - (n))))
+#define CH(x, y, z)	(((x) & (y)) ^ (~(x) & (z)))
+#define MAJ(x, y, z)	(((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+
+#define F1(x)	(ROTR(x,  2) ^ ROTR(x, 13) ^ ROTR(x, 22))
+#define F2(x)	(ROTR(x,  6) ^ ROTR(x, 11) ^ ROTR(x, 25))
+#define F3(x)	(ROTR(x,  7) ^ ROTR(x, 18) ^ ((x) >> 3))
+#define F4(x)	(ROTR(x, 17) ^ ROTR(x, 19) ^ ((x) >> 10))
+
+#define L	SHA256_MB_LANES
+
+static const unsigned char idle_block[SHA256_BLOCK_SIZE];
+
+static uint32_t get_be32(const unsigned char *p)
+{
+	return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+	       ((uint32_t)p[2] << 8) | p[3];
+}
+
+static void put_be32(unsigned char *p, uint32_t v)
+{
+	p[0] = v >> 24;
+	p[1] = v >> 16;
+	p[2] = v >> 8;
+	p[3] = v;
+}
+
+static void sha256_mb_transf(struct sha256_mb_ctx *ctx,
+			     const unsigned char *blk[L])
+{
+	uint32_t wv[8][L];
+	uint32_t t1[L];
+	uint32_t t2[L];
+	int j;
+	int l;
+
+	for (j = 0; j < 16; j++)
+		for (l = 0; l < L; l++)
+			ctx->w[j][l] = get_be32(blk[l] + 4 * j);
+
+	for (j = 16; j < 64; j++)
+		for (l = 0; l < L; l++)
+			ctx->w[j][l] = F4(ctx->w[j - 2][l]) + ctx->w[j - 7][l] +
+				       F3(ctx->w[j - 15][l]) +
+				       ctx->w[j - 16][l];
+
+	memcpy(wv, ctx->h, sizeof(wv));
+
+	for (j = 0; j < 64; j++) {
+		for (l = 0; l < L; l++) {
+			t1[l] = wv[7][l] + F2(wv[4][l]) +
+				CH(wv[4][l], wv[5][l], wv[6][l]) +
+				sha256_k[j] + ctx->w[j][l];
+			t2[l] = F1(wv[0][l]) +
+				MAJ(wv[0][l], wv[1][l], wv[2][l]);
+		}
+		for (l = 0; l < L; l++) {
+			wv[7][l] = wv[6][l];
+			wv[6][l] = wv[5][l];
+			wv[5][l] = wv[4][l];
+			wv[4][l] = wv[3][l] + t1[l];
+			wv[3][l] = wv[2][l];
+			wv[2][l] = wv[1][l];
+			wv[1][l] = wv[0][l];
+			wv[0][l] = t1[l] + t2[l];
+		}
+	}
+
+	for (j = 0; j < 8; j++)
+		for (l = 0; l < L; l++)
+			ctx->h[j][l] += wv[j][l];
+}
+
+static void lane_load(struct sha256_mb_ctx *ctx, int l,
+		      const unsigned char *msg, uint32_t len,
+		      unsigned char *digest)
+{
+	struct sha256_mb_lane *lane = &ctx->lane[l];
+	unsigned int rem = len % SHA256_BLOCK_SIZE;
+	uint64_t bit_len = (uint64_t)len << 3;
+	unsigned char *p;
+	int j;
+
+	lane->next = msg;
+	lane->full_blocks = len / SHA256_BLOCK_SIZE;
+	lane->pad_blocks = rem + 9 > SHA256_BLOCK_SIZE ? 2 : 1;
+	lane->pad_pos = 0;
+	lane->digest = digest;
+
+	memset(lane->pad, 0, sizeof(lane->pad));
+	memcpy(lane->pad, msg + len - rem, rem);
+	lane->pad[rem] = 0x80;
+	p = lane->pad + lane->pad_blocks * SHA256_BLOCK_SIZE - 8;
+	put_be32(p, bit_len >> 32);
+	put_be32(p + 4, bit_len);
+
+	for (j = 0; j < 8; j++)
+		ctx->h[j][l] = sha256_h0[j];
+}
+
+static const unsigned char *lane_next_block(struct sha256_mb_lane *lane)
+{
+	const unsigned char *p;
+
+	if (lane->full_blocks) {
+		p = lane->next;
+		lane->next += SHA256_BLOCK_SIZE;
+		lane->full_blocks--;
+	} else {
+		p = lane->pad + lane->pad_pos * SHA256_BLOCK_SIZE;
+		lane->pad_pos++;
+	}
+	return p;
+}
+
+void sha256_mb(struct sha256_mb_ctx *ctx, const unsigned char *base,
+	       const uint32_t *offs_len, unsigned int n,
+	       unsigned char *digests)
+{
+	const unsigned char *blk[L];
+	unsigned int next_msg = 0;
+	unsigned int active = 0;
+	int j;
+	int l;
+
+	for (l = 0; l < L; l++) {
+		ctx->lane[l].digest = NULL;
+		if (next_msg < n) {
+			lane_load(ctx, l, base + offs_len[2 * next_msg],
+				  offs_len[2 * next_msg + 1],
+				  digests + next_msg * SHA256_DIGEST_SIZE);
+			next_msg++;
+			active++;
+		}
+	}
+
+	while (active) {
+		for (l = 0; l < L; l++) {
+			if (ctx->lane[l].digest)
+				blk[l] = lane_next_block(&ctx->lane[l]);
+			else
+				blk[l] = idle_block;
+		}
+
+		sha256_mb_transf(ctx, blk);
+
+		for (l = 0; l < L; l++) {
+			struct sha256_mb_lane *lane = &ctx->lane[l];
+
+			if (!lane->digest || lane->full_blocks ||
+			    lane->pad_pos != lane->pad_blocks)
+				continue;
+
+			for (j = 0; j < 8; j++)
+				put_be32(lane->digest + 4 * j, ctx->h[j][l]);
+
+			lane->digest = NULL;
+			active--;
+			if (next_msg < n) {
+				lane_load(ctx, l, base + offs_len[2 * next_msg],
+					  offs_len[2 * next_msg + 1],
+					  digests +
+					  next_msg * SHA256_DIGEST_SIZE);
+				next_msg++;
+				active++;
+			}
+		}
+	}
+}
@@ -27,6 +27,8 @@
 
 #include "sha2_taf.h"
 #include "sha2_impl.h"
+#include "sha2_mb.h"
+#include "ta_crypt.h"
 
 TEE_Result ta_entry_sha224(uint32_t param_types, TEE_Param params[4])
 {
@@ -51,25 +53,260 @@ TEE_Result ta_entry_sha224(uint32_t param_types, TEE_Param params[4])
 	return TEE_SUCCESS;
 }
 
+static sha256_transf_fn sha256_impl_transf(uint32_t impl)
+{
+	switch (impl) {
+	case TA_CRYPT_SHA256_IMPL_ROLLED:
+		return sha256_transf_rolled;
+	case TA_CRYPT_SHA256_IMPL_UNROLLED:
+		return sha256_transf_unrolled;
+#ifdef CFG_TA_CRYPT_ARMV8_CE
+	case TA_CRYPT_SHA256_IMPL_ARMV8_CE:
+		return sha256_armv8ce_transf;
+#endif
+	default:
+		return NULL;
+	}
+}
+
+/*
+ * params[2] is optional, if present params[2].value.a selects the block
+ * function, see TA_CRYPT_SHA256_IMPL_*
+ */
 TEE_Result ta_entry_sha256(uint32_t param_types, TEE_Param params[4])
 {
+	sha256_transf_fn fn = NULL;
+
 /*
  * It is expected that memRef[0] is input buffer and memRef[1] is
  * output buffer.
  */
-	if (param_types !=
+	if (param_types ==
 	    TEE_PARAM_TYPES(TEE_PARAM_TYPE_MEMREF_INPUT,
-			    TEE_PARAM_TYPE_MEMREF_OUTPUT, TEE_PARAM_TYPE_NONE,
-			    TEE_PARAM_TYPE_NONE)) {
+			    TEE_PARAM_TYPE_MEMREF_OUTPUT,
+			    TEE_PARAM_TYPE_VALUE_INPUT, TEE_PARAM_TYPE_NONE)) {
+		fn = sha256_impl_transf(params[2].value.a);
+		if (!fn)
+			return TEE_ERROR_NOT_SUPPORTED;
+	} else if (param_types !=
+		   TEE_PARAM_TYPES(TEE_PARAM_TYPE_MEMREF_INPUT,
+				   TEE_PARAM_TYPE_MEMREF_OUTPUT,
+				   TEE_PARAM_TYPE_NONE, TEE_PARAM_TYPE_NONE)) {
 		return TEE_ERROR_BAD_PARAMETERS;
 	}
 
 	if (params[1].memref.size < SHA256_DIGEST_SIZE)
 		return TEE_ERROR_BAD_PARAMETERS;
 
+	if (fn)
+		sha256_set_transf(fn);
 	sha256((unsigned char *)params[0].memref.buffer,
 	       (unsigned int)params[0].memref.size,
 	       (unsigned char *)params[1].memref.buffer);
+	if (fn)
+		sha256_set_transf(NULL);
+
+	return TEE_SUCCESS;
+}
+
+static uint32_t tee_time_to_ms(TEE_Time t)
+{
+	return t.seconds * 1000 + t.millis;
+}
+
+TEE_Result ta_entry_sha256_bench(uint32_t param_types, TEE_Param params[4])
+{
+	uint32_t *times;
+	unsigned char *digests;
+	TEE_Time start;
+	TEE_Time stop;
+	sha256_transf_fn fn;
+	uint32_t impl;
+	uint32_t n;
+
+	if (param_types !=
+	    TEE_PARAM_TYPES(TEE_PARAM_TYPE_MEMREF_INPUT,
+			    TEE_PARAM_TYPE_VALUE_INPUT,
+			    TEE_PARAM_TYPE_MEMREF_OUTPUT,
+			    TEE_PARAM_TYPE_MEMREF_OUTPUT)) {
+		return TEE_ERROR_BAD_PARAMETERS;
+	}
+
+	if (params[2].memref.size <
+		TA_CRYPT_SHA256_IMPL_COUNT * sizeof(uint32_t) ||
+	    params[3].memref.size <
+		TA_CRYPT_SHA256_IMPL_COUNT * SHA256_DIGEST_SIZE)
+		return TEE_ERROR_SHORT_BUFFER;
+
+	times = params[2].memref.buffer;
+	digests = params[3].memref.buffer;
+
+	for (impl = 0; impl < TA_CRYPT_SHA256_IMPL_COUNT; impl++) {
+		unsigned char *digest = digests + impl * SHA256_DIGEST_SIZE;
+
+		fn = sha256_impl_transf(impl);
+		if (!fn) {
+			times[impl] = TA_CRYPT_BENCH_NOT_AVAILABLE;
+			TEE_MemFill(digest, 0, SHA256_DIGEST_SIZE);
+			continue;
+		}
+
+		sha256_set_transf(fn);
+		TEE_GetSystemTime(&start);
+		for (n = 0; n < params[1].value.a; n++)
+			sha256(params[0].memref.buffer,
+			       params[0].memref.size, digest);
+		TEE_GetSystemTime(&stop);
+		times[impl] = tee_time_to_ms(stop) - tee_time_to_ms(start);
+	}
+	sha256_set_transf(NULL);
+
+	params[2].memref.size = TA_CRYPT_SHA256_IMPL_COUNT * sizeof(uint32_t);
+	params[3].memref.size = TA_CRYPT_SHA256_IMPL_COUNT * SHA256_DIGEST_SIZE;
+
+	return TEE_SUCCESS;
+}
+
+TEE_Result ta_entry_sha256_multi(uint32_t param_types, TEE_Param params[4])
+{
+	TEE_Result res = TEE_SUCCESS;
+	struct sha256_mb_ctx *ctx = NULL;
+	uint32_t *tbl = NULL;
+	size_t data_size;
+	size_t n;
+	size_t i;
+
+	if (param_types !=
+	    TEE_PARAM_TYPES(TEE_PARAM_TYPE_MEMREF_INPUT,
+			    TEE_PARAM_TYPE_MEMREF_INPUT,
+			    TEE_PARAM_TYPE_MEMREF_OUTPUT,
+			    TEE_PARAM_TYPE_NONE)) {
+		return TEE_ERROR_BAD_PARAMETERS;
+	}
+
+	if (params[0].memref.size % sizeof(struct ta_crypt_sha256_msg))
+		return TEE_ERROR_BAD_PARAMETERS;
+	n = params[0].memref.size / sizeof(struct ta_crypt_sha256_msg);
+	if (n > SIZE_MAX / SHA256_DIGEST_SIZE)
+		return TEE_ERROR_BAD_PARAMETERS;
+
+	if (params[2].memref.size < n * SHA256_DIGEST_SIZE) {
+		params[2].memref.size = n * SHA256_DIGEST_SIZE;
+		return TEE_ERROR_SHORT_BUFFER;
+	}
+	params[2].memref.size = n * SHA256_DIGEST_SIZE;
+	if (!n)
+		return TEE_SUCCESS;
+
+	/*
+	 * The table is in shared memory, take a private copy before it's
+	 * checked so it can't change under our feet.
+	 */
+	tbl = TEE_Malloc(params[0].memref.size, 0);
+	ctx = TEE_Malloc(sizeof(*ctx), 0);
+	if (!tbl || !ctx) {
+		res = TEE_ERROR_OUT_OF_MEMORY;
+		goto out;
+	}
+	TEE_MemMove(tbl, params[0].memref.buffer, params[0].memref.size);
+
+	data_size = params[1].memref.size;
+	for (i = 0; i < n; i++) {
+		if (tbl[2 * i] > data_size ||
+		    tbl[2 * i + 1] > data_size - tbl[2 * i]) {
+			res = TEE_ERROR_BAD_PARAMETERS;
+			goto out;
+		}
+	}
+
+	sha256_mb(ctx, params[1].memref.buffer, tbl, n,
+		  params[2].memref.buffer);
+out:
+	TEE_Free(ctx);
+	TEE_Free(tbl);
+	return res;
+}
+
+TEE_Result ta_entry_sha2_init(struct sha2_taf_stream *st,
+			      uint32_t param_types, TEE_Param params[4])
+{
+	if (param_types !=
+	    TEE_PARAM_TYPES(TEE_PARAM_TYPE_VALUE_INPUT, TEE_PARAM_TYPE_NONE,
+			    TEE_PARAM_TYPE_NONE, TEE_PARAM_TYPE_NONE)) {
+		return TEE_ERROR_BAD_PARAMETERS;
+	}
+
+	switch (params[0].value.a) {
+	case TEE_ALG_SHA224:
+		sha224_init(&st->ctx.sha224);
+		break;
+	case TEE_ALG_SHA256:
+		sha256_init(&st->ctx.sha256);
+		break;
+	default:
+		return TEE_ERROR_NOT_SUPPORTED;
+	}
+
+	st->algo = params[0].value.a;
+	return TEE_SUCCESS;
+}
+
+TEE_Result ta_entry_sha2_update(struct sha2_taf_stream *st,
+				uint32_t param_types, TEE_Param params[4])
+{
+	if (param_types !=
+	    TEE_PARAM_TYPES(TEE_PARAM_TYPE_MEMREF_INPUT, TEE_PARAM_TYPE_NONE,
+			    TEE_PARAM_TYPE_NONE, TEE_PARAM_TYPE_NONE)) {
+		return TEE_ERROR_BAD_PARAMETERS;
+	}
+
+	switch (st->algo) {
+	case TEE_ALG_SHA224:
+		sha224_update(&st->ctx.sha224, params[0].memref.buffer,
+			      params[0].memref.size);
+		return TEE_SUCCESS;
+	case TEE_ALG_SHA256:
+		sha256_update(&st->ctx.sha256, params[0].memref.buffer,
+			      params[0].memref.size);
+		return TEE_SUCCESS;
+	default:
+		return TEE_ERROR_BAD_STATE;
+	}
+}
+
+TEE_Result ta_entry_sha2_final(struct sha2_taf_stream *st,
+			       uint32_t param_types, TEE_Param params[4])
+{
+	size_t digest_size;
+
+	if (param_types !=
+	    TEE_PARAM_TYPES(TEE_PARAM_TYPE_MEMREF_OUTPUT, TEE_PARAM_TYPE_NONE,
+			    TEE_PARAM_TYPE_NONE, TEE_PARAM_TYPE_NONE)) {
+		return TEE_ERROR_BAD_PARAMETERS;
+	}
+
+	switch (st->algo) {
+	case TEE_ALG_SHA224:
+		digest_size = SHA224_DIGEST_SIZE;
+		break;
+	case TEE_ALG_SHA256:
+		digest_size = SHA256_DIGEST_SIZE;
+		break;
+	default:
+		return TEE_ERROR_BAD_STATE;
+	}
+
+	if (params[0].memref.size < digest_size) {
+		params[0].memref.size = digest_size;
+		return TEE_ERROR_SHORT_BUFFER;
+	}
+
+	if (st->algo == TEE_ALG_SHA224)
+		sha224_final(&st->ctx.sha224, params[0].memref.buffer);
+	else
+		sha256_final(&st->ctx.sha256, params[0].memref.buffer);
 
+	params[0].memref.size = digest_size;
+	st->algo = 0;
 	return TEE_SUCCESS;
 }
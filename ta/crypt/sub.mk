@@ -1,7 +1,18 @@
 global-incdirs-y += include
 srcs-y += aes_impl.c
 srcs-y += aes_taf.c
+srcs-y += batch_taf.c
 srcs-y += cryp_taf.c
 srcs-y += sha2_impl.c
+srcs-y += sha2_mb.c
 srcs-y += sha2_taf.c
 srcs-y += ta_entry.c
+
+# ARMv8 Crypto Extensions AES and SHA-256, needs a 64-bit TA dev kit
+# with CFG_WITH_VFP=y since the SIMD registers are used. A TA can't probe
+# the CPU for the instructions, only set this when the hardware has them.
+cppflags-$(CFG_TA_CRYPT_ARMV8_CE) += -DCFG_TA_CRYPT_ARMV8_CE=1
+srcs-$(CFG_TA_CRYPT_ARMV8_CE) += aes_armv8ce.c
+cflags-aes_armv8ce.c-y += -march=armv8-a+crypto
+srcs-$(CFG_TA_CRYPT_ARMV8_CE) += sha2_armv8ce.c
+cflags-sha2_armv8ce.c-y += -march=armv8-a+crypto
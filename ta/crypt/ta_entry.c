@@ -29,6 +29,7 @@
 #include <ta_crypt.h>
 #include <aes_taf.h>
 #include <sha2_taf.h>
+#include <batch_taf.h>
 #include <cryp_taf.h>
 #include <trace.h>
 
@@ -36,6 +37,11 @@ static TEE_Result set_global(uint32_t param_types, TEE_Param params[4]);
 static TEE_Result get_global(uint32_t param_types, TEE_Param params[4]);
 static int _globalvalue;
 
+/* Per session state */
+struct ta_crypt_session {
+	struct sha2_taf_stream sha2;
+};
+
 /*
  * Trusted Application Entry Points
  */
@@ -56,16 +62,23 @@ TEE_Result TA_OpenSessionEntryPoint(uint32_t nParamTypes,
 				    TEE_Param pParams[4],
 				    void **ppSessionContext)
 {
+	struct ta_crypt_session *sess;
+
 	(void)nParamTypes;
 	(void)pParams;
-	(void)ppSessionContext;
+
+	sess = TEE_Malloc(sizeof(*sess), 0);
+	if (!sess)
+		return TEE_ERROR_OUT_OF_MEMORY;
+
+	*ppSessionContext = sess;
 	return TEE_SUCCESS;
 }
 
 /* Called each time a session is closed */
 void TA_CloseSessionEntryPoint(void *pSessionContext)
 {
-	(void)pSessionContext;
+	TEE_Free(pSessionContext);
 }
 
 /*
@@ -78,15 +91,11 @@ static TEE_Result (*ta_cmd_entries[])(uint32_t, TEE_Param *) = {
 	[TA_CRYPT_CMD_SHA256] = ta_entry_sha256,
 };
 
-/* Called when a command is invoked */
-TEE_Result TA_InvokeCommandEntryPoint(void *pSessionContext,
-				      uint32_t nCommandID, uint32_t nParamTypes,
-				      TEE_Param pParams[4])
+static TEE_Result invoke_command(void *pSessionContext, uint32_t nCommandID,
+				 uint32_t nParamTypes, TEE_Param pParams[4])
 {
 	static bool use_fptr = false;
-
-	(void)pSessionContext;
-
+	struct ta_crypt_session *sess = pSessionContext;
 
 	switch (nCommandID) {
 	case TA_CRYPT_CMD_SHA224:
@@ -220,11 +229,42 @@ TEE_Result TA_InvokeCommandEntryPoint(void *pSessionContext,
 	case TA_CRYPT_CMD_GETGLOBAL:
 		return get_global(nParamTypes, pParams);
 
+	case TA_CRYPT_CMD_SHA256_BENCH:
+		return ta_entry_sha256_bench(nParamTypes, pParams);
+
+	case TA_CRYPT_CMD_SHA256_MULTI:
+		return ta_entry_sha256_multi(nParamTypes, pParams);
+
+	case TA_CRYPT_CMD_SHA2_INIT:
+		return ta_entry_sha2_init(&sess->sha2, nParamTypes, pParams);
+
+	case TA_CRYPT_CMD_SHA2_UPDATE:
+		return ta_entry_sha2_update(&sess->sha2, nParamTypes, pParams);
+
+	case TA_CRYPT_CMD_SHA2_FINAL:
+		return ta_entry_sha2_final(&sess->sha2, nParamTypes, pParams);
+
+	case TA_CRYPT_CMD_DIGEST_FORK:
+		return ta_entry_digest_fork(nParamTypes, pParams);
+
 	default:
 		return TEE_ERROR_BAD_PARAMETERS;
 	}
 }
 
+/* Called when a command is invoked */
+TEE_Result TA_InvokeCommandEntryPoint(void *pSessionContext,
+				      uint32_t nCommandID, uint32_t nParamTypes,
+				      TEE_Param pParams[4])
+{
+	if (nCommandID == TA_CRYPT_CMD_BATCH)
+		return ta_entry_batch(invoke_command, pSessionContext,
+				      nParamTypes, pParams);
+
+	return invoke_command(pSessionContext, nCommandID, nParamTypes,
+			      pParams);
+}
+
 static TEE_Result set_global(uint32_t param_types, TEE_Param params[4])
 {
 	int i;